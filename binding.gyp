@@ -4,11 +4,15 @@
 			'target_name': 'rational',               # The name of a target being defined.
 			'sources'  : [                           # A list of source files that are used to build this target.
 				'src/rational-addon.cpp',
+				'src/rational-async.cpp',
+				'src/rational-arrays.cpp',
+				'src/accumulator-addon.cpp',
+				'src/bigrational-addon.cpp',
 				'src/addon.cpp'
 			],
 			'cflags'   : [
 				'-Wall',
-				'-std=c++11',
+				'-std=c++17',
 				'-fexceptions'
 			],
 			'cflags_cc': [
@@ -17,7 +21,7 @@
 			'xcode_settings': {
 				'OTHER_CFLAGS': [
 					'-Wall',
-					'-std=c++11',
+					'-std=c++17',
 					'-fexceptions'
 				]
 			},
@@ -38,7 +42,7 @@
 			"conditions": [
 				[ 'OS=="mac"', {
 					"xcode_settings": {
-							'OTHER_CPLUSPLUSFLAGS' : ['-std=c++11','-stdlib=libc++'],
+							'OTHER_CPLUSPLUSFLAGS' : ['-std=c++17','-stdlib=libc++'],
 							'OTHER_LDFLAGS': ['-stdlib=libc++'],
 							'MACOSX_DEPLOYMENT_TARGET': '10.7'
 						}
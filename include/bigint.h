@@ -0,0 +1,764 @@
+/**
+ * @file    bigint.h
+ * @author  Essam A. El-Sherif
+ * @version v1.0.0
+ *
+ * A C++ header that defines a class 'bigint' for representing arbitrary precision integers,
+ * satisfying the requirements of the integer type of the template based class 'rational'.
+ */
+
+#ifndef __BIGINT_H__
+#define __BIGINT_H__
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * A namespace to enclose the C++ rational class and global helper classes and functions.
+ */
+namespace src{
+
+	/**
+	 * A class for representing arbitrary precision signed integers.
+	 *
+	 * Values that fit in a long long are stored inline and never allocate; larger
+	 * values are stored as a sign and a little endian vector of 32-bit limbs. The
+	 * representation is canonical: the limbs are in use only when the value does
+	 * not fit in a long long.
+	 */
+	class bigint{
+		private:
+			typedef std::uint32_t limb;
+			typedef std::uint64_t dlimb;
+
+			/** A read only view of the magnitude of a value as little endian limbs. */
+			struct view{
+				const limb *p;     /**< Pointer to the least significant limb. */
+				std::size_t n;     /**< Number of limbs, zero for a zero value. */
+				bool neg;          /**< Sign of the value. */
+				limb buf[2];       /**< Storage of the limbs of a small value. */
+
+				explicit view(const bigint&);
+
+				view(const view&) = delete;
+				view& operator =(const view&) = delete;
+			};
+
+		private: /* Helper static functions [8] */
+
+			/** Build a canonical value from a sign and a magnitude. */
+			static bigint make(bool, std::vector<limb>&);
+
+			/** Compare two magnitudes. */
+			static int cmp_mag(const limb*, std::size_t, const limb*, std::size_t);
+
+			/** Sum of two magnitudes. */
+			static void add_mag(const limb*, std::size_t, const limb*, std::size_t, std::vector<limb>&);
+
+			/** Difference of two magnitudes, the first being the larger. */
+			static void sub_mag(const limb*, std::size_t, const limb*, std::size_t, std::vector<limb>&);
+
+			/** Product of two magnitudes. */
+			static void mul_mag(const limb*, std::size_t, const limb*, std::size_t, std::vector<limb>&);
+
+			/** Quotient and remainder of two magnitudes (Knuth's algorithm D). */
+			static void divmod_mag(const limb*, std::size_t, const limb*, std::size_t, std::vector<limb>&, std::vector<limb>&);
+
+			/** Signed sum of two values. */
+			static bigint add(const bigint&, const bigint&, bool);
+
+			/** Signed quotient and remainder of two values, truncated toward zero. */
+			static void divmod(const bigint&, const bigint&, bigint*, bigint*);
+
+		private:
+			long long small;          /**< Value when the limbs are not in use.*/
+			bool negative;            /**< Sign when the limbs are in use.*/
+			std::vector<limb> limbs;  /**< Magnitude when the value does not fit in a long long.*/
+
+			bool is_small() const { return limbs.empty(); }
+
+		public:
+			/* Constructors [3] */
+			bigint() : small(0), negative(false){}  /**< Default constructor. */
+
+			/** Conversion from a built-in integer type. */
+			template<typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+			bigint(T);
+
+			explicit bigint(const std::string&);  /**< Conversion from a decimal string. */
+
+			/* Conversions [3] */
+			explicit operator bool() const { return !is_small() || small != 0; }  /**< Boolean conversion. */
+			explicit operator double() const;                                    /**< Floating point conversion. */
+
+			/** Conversion to a built-in integer type, throws std::range_error if not representable. */
+			template<typename T, typename = typename std::enable_if<
+				std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+			explicit operator T() const;
+
+			/* Word conversions [2] */
+			static bigint from_words(bool, const std::uint64_t*, std::size_t);  /**< Value of a sign and a magnitude of little endian 64-bit words. */
+			std::vector<std::uint64_t> to_words() const;                       /**< Magnitude as little endian 64-bit words, none for zero. */
+
+			/* Inspection [3] */
+			int sign() const;                /**< Sign of the value as -1, 0 or 1. */
+			std::size_t bit_length() const;  /**< Number of bits of the magnitude, 0 for zero. */
+			std::string to_string() const;   /**< Decimal representation. */
+
+			/* Arithmetic assignment operators [5] */
+			bigint& operator +=(const bigint&);  /**< Arithmetic assignment operator += */
+			bigint& operator -=(const bigint&);  /**< Arithmetic assignment operator -= */
+			bigint& operator *=(const bigint&);  /**< Arithmetic assignment operator *= */
+			bigint& operator /=(const bigint&);  /**< Arithmetic assignment operator /= */
+			bigint& operator %=(const bigint&);  /**< Arithmetic assignment operator %= */
+
+			/* Increment and decrement operators [4] */
+			bigint& operator ++();     /**< Pre-increment operator. */
+			bigint& operator --();     /**< Pre-decrement operator. */
+			bigint operator ++(int);   /**< Post-increment operator. */
+			bigint operator --(int);   /**< Post-decrement operator. */
+
+			/* Unary operators [3] */
+			bigint operator +() const { return *this; }  /**< Unary operator + */
+			bigint operator -() const;                   /**< Unary operator - */
+			bool operator !() const { return !static_cast<bool>(*this); }  /**< Not operator. */
+
+			/* Binary operators [5] */
+			friend bigint operator +(const bigint&, const bigint&);
+			friend bigint operator -(const bigint&, const bigint&);
+			friend bigint operator *(const bigint&, const bigint&);
+			friend bigint operator /(const bigint&, const bigint&);
+			friend bigint operator %(const bigint&, const bigint&);
+
+			/* Comparison operators [7] */
+			friend int compare(const bigint&, const bigint&);
+			friend bool operator ==(const bigint&, const bigint&);
+			friend bool operator !=(const bigint&, const bigint&);
+			friend bool operator  <(const bigint&, const bigint&);
+			friend bool operator  >(const bigint&, const bigint&);
+			friend bool operator <=(const bigint&, const bigint&);
+			friend bool operator >=(const bigint&, const bigint&);
+	};
+
+	/* Global binary operators [5] */
+	bigint operator +(const bigint&, const bigint&);
+	bigint operator -(const bigint&, const bigint&);
+	bigint operator *(const bigint&, const bigint&);
+	bigint operator /(const bigint&, const bigint&);
+	bigint operator %(const bigint&, const bigint&);
+
+	/* Global comparison operators [7] */
+	int  compare(const bigint&, const bigint&);  /**< Three-way comparison as -1, 0 or 1. */
+	bool operator ==(const bigint&, const bigint&);
+	bool operator !=(const bigint&, const bigint&);
+	bool operator  <(const bigint&, const bigint&);
+	bool operator  >(const bigint&, const bigint&);
+	bool operator <=(const bigint&, const bigint&);
+	bool operator >=(const bigint&, const bigint&);
+
+	/* Global input and output operators [2] */
+	std::istream& operator >>(std::istream&, bigint&);
+	std::ostream& operator <<(std::ostream&, const bigint&);
+}
+
+namespace std{
+	/**
+	 * Specialization of the numeric limits for the unbounded bigint type.
+	 */
+	template<>
+	class numeric_limits<src::bigint>{
+		public:
+			static const bool is_specialized = true;
+			static const bool is_signed      = true;
+			static const bool is_integer     = true;
+			static const bool is_exact       = true;
+			static const bool is_bounded     = false;
+			static const bool is_modulo      = false;
+			static const int  radix          = 2;
+			static const int  digits         = 0;
+			static const int  digits10       = 0;
+
+			static src::bigint min(){ return src::bigint(); }  /**< Meaningless for unbounded types. */
+			static src::bigint max(){ return src::bigint(); }  /**< Meaningless for unbounded types. */
+	};
+}
+
+/* Views [1] */
+inline src::bigint::view::view(const bigint& x){
+	if(x.is_small()){
+		const unsigned long long m = x.small < 0
+			? 0ULL - static_cast<unsigned long long>(x.small)
+			: static_cast<unsigned long long>(x.small);
+
+		buf[0] = static_cast<limb>(m);
+		buf[1] = static_cast<limb>(m >> 32);
+
+		p   = buf;
+		n   = buf[1] ? 2 : buf[0] ? 1 : 0;
+		neg = x.small < 0;
+	}
+	else{
+		p   = x.limbs.data();
+		n   = x.limbs.size();
+		neg = x.negative;
+	}
+}
+
+/* Constructors [3] */
+template<typename T, typename>
+src::bigint::bigint(T t) : small(0), negative(false){
+	if(std::is_signed<T>::value || static_cast<unsigned long long>(t) <= static_cast<unsigned long long>(LLONG_MAX)){
+		small = static_cast<long long>(t);
+	}
+	else{
+		const unsigned long long m = static_cast<unsigned long long>(t);
+		limbs.push_back(static_cast<limb>(m));
+		limbs.push_back(static_cast<limb>(m >> 32));
+	}
+}
+
+inline src::bigint::bigint(const std::string& s) : small(0), negative(false){
+	std::size_t i = 0;
+	bool neg = false;
+
+	if(i < s.size() && (s[i] == '-' || s[i] == '+')){
+		neg = s[i] == '-';
+		++i;
+	}
+
+	if(i == s.size()){
+		throw std::invalid_argument("bigint: invalid decimal string");
+	}
+
+	std::vector<limb> mag;
+
+	for( ; i < s.size(); ++i){
+		if(s[i] < '0' || s[i] > '9'){
+			throw std::invalid_argument("bigint: invalid decimal string");
+		}
+
+		dlimb carry = static_cast<dlimb>(s[i] - '0');
+		for(std::size_t k = 0; k < mag.size(); ++k){
+			const dlimb t = static_cast<dlimb>(mag[k]) * 10u + carry;
+			mag[k] = static_cast<limb>(t);
+			carry = t >> 32;
+		}
+		if(carry) mag.push_back(static_cast<limb>(carry));
+	}
+
+	*this = make(neg, mag);
+}
+
+/* Helper static functions [8] */
+inline src::bigint src::bigint::make(bool neg, std::vector<limb>& mag){
+	while(!mag.empty() && mag.back() == 0) mag.pop_back();
+
+	bigint r;
+
+	if(mag.size() <= 2){
+		const unsigned long long m =
+			(mag.size() > 0 ? static_cast<unsigned long long>(mag[0]) : 0ULL) |
+			(mag.size() > 1 ? static_cast<unsigned long long>(mag[1]) << 32 : 0ULL);
+
+		if(m <= static_cast<unsigned long long>(LLONG_MAX)){
+			r.small = neg ? -static_cast<long long>(m) : static_cast<long long>(m);
+			return r;
+		}
+
+		if(neg && m == static_cast<unsigned long long>(LLONG_MAX) + 1ULL){
+			r.small = LLONG_MIN;
+			return r;
+		}
+	}
+
+	r.negative = neg;
+	r.limbs.swap(mag);
+	return r;
+}
+
+inline int src::bigint::cmp_mag(const limb *a, std::size_t an, const limb *b, std::size_t bn){
+	if(an != bn) return an < bn ? -1 : 1;
+
+	for(std::size_t i = an; i-- > 0; ){
+		if(a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+	}
+
+	return 0;
+}
+
+inline void src::bigint::add_mag(const limb *a, std::size_t an, const limb *b, std::size_t bn, std::vector<limb>& r){
+	if(an < bn){
+		std::swap(a, b);
+		std::swap(an, bn);
+	}
+
+	r.assign(an + 1, 0);
+
+	dlimb carry = 0;
+	for(std::size_t i = 0; i < an; ++i){
+		const dlimb t = static_cast<dlimb>(a[i]) + (i < bn ? b[i] : 0u) + carry;
+		r[i] = static_cast<limb>(t);
+		carry = t >> 32;
+	}
+	r[an] = static_cast<limb>(carry);
+}
+
+inline void src::bigint::sub_mag(const limb *a, std::size_t an, const limb *b, std::size_t bn, std::vector<limb>& r){
+	r.assign(an, 0);
+
+	long long borrow = 0;
+	for(std::size_t i = 0; i < an; ++i){
+		long long t = static_cast<long long>(a[i]) - (i < bn ? static_cast<long long>(b[i]) : 0LL) - borrow;
+		borrow = t < 0;
+		if(t < 0) t += 1LL << 32;
+		r[i] = static_cast<limb>(t);
+	}
+}
+
+inline void src::bigint::mul_mag(const limb *a, std::size_t an, const limb *b, std::size_t bn, std::vector<limb>& r){
+	r.assign(an + bn, 0);
+
+	for(std::size_t i = 0; i < an; ++i){
+		dlimb carry = 0;
+		for(std::size_t j = 0; j < bn; ++j){
+			const dlimb t = static_cast<dlimb>(a[i]) * b[j] + r[i + j] + carry;
+			r[i + j] = static_cast<limb>(t);
+			carry = t >> 32;
+		}
+		r[i + bn] = static_cast<limb>(carry);
+	}
+}
+
+/*
+ * Knuth, The Art of Computer Programming, vol. 2, section 4.3.1, algorithm D,
+ * in the form given by Warren, Hacker's Delight, section 9.2 (divmnu).
+ */
+inline void src::bigint::divmod_mag(const limb *u, std::size_t m, const limb *v, std::size_t n,
+	std::vector<limb>& q, std::vector<limb>& r){
+
+	const dlimb b = 1ULL << 32;
+
+	if(cmp_mag(u, m, v, n) < 0){
+		q.clear();
+		r.assign(u, u + m);
+		return;
+	}
+
+	if(n == 1){
+		q.assign(m, 0);
+
+		dlimb k = 0;
+		for(std::size_t j = m; j-- > 0; ){
+			const dlimb t = k * b + u[j];
+			q[j] = static_cast<limb>(t / v[0]);
+			k = t % v[0];
+		}
+
+		r.assign(1, static_cast<limb>(k));
+		return;
+	}
+
+	/* Normalize so that the most significant limb of the divisor has its top bit set. */
+	int s = 0;
+	for(limb top = v[n - 1]; !(top & 0x80000000u); top <<= 1) ++s;
+
+	std::vector<limb> vn(n), un(m + 1);
+
+	for(std::size_t i = n - 1; i > 0; --i)
+		vn[i] = static_cast<limb>((v[i] << s) | (s ? static_cast<dlimb>(v[i - 1]) >> (32 - s) : 0u));
+	vn[0] = v[0] << s;
+
+	un[m] = s ? static_cast<limb>(static_cast<dlimb>(u[m - 1]) >> (32 - s)) : 0u;
+	for(std::size_t i = m - 1; i > 0; --i)
+		un[i] = static_cast<limb>((u[i] << s) | (s ? static_cast<dlimb>(u[i - 1]) >> (32 - s) : 0u));
+	un[0] = u[0] << s;
+
+	q.assign(m - n + 1, 0);
+
+	for(std::size_t j = m - n + 1; j-- > 0; ){
+		const dlimb num = static_cast<dlimb>(un[j + n]) * b + un[j + n - 1];
+		dlimb qhat = num / vn[n - 1];
+		dlimb rhat = num - qhat * vn[n - 1];
+
+		while(qhat >= b || qhat * vn[n - 2] > b * rhat + un[j + n - 2]){
+			--qhat;
+			rhat += vn[n - 1];
+			if(rhat >= b) break;
+		}
+
+		/* Multiply and subtract. */
+		long long k = 0, t = 0;
+		for(std::size_t i = 0; i < n; ++i){
+			const dlimb p = qhat * vn[i];
+			t = static_cast<long long>(un[i + j]) - k - static_cast<long long>(p & 0xFFFFFFFFULL);
+			un[i + j] = static_cast<limb>(t);
+			k = static_cast<long long>(p >> 32) - (t >> 32);
+		}
+		t = static_cast<long long>(un[j + n]) - k;
+		un[j + n] = static_cast<limb>(t);
+
+		q[j] = static_cast<limb>(qhat);
+
+		/* Add back when the quotient digit was one too large. */
+		if(t < 0){
+			--q[j];
+			k = 0;
+			for(std::size_t i = 0; i < n; ++i){
+				t = static_cast<long long>(static_cast<dlimb>(un[i + j]) + vn[i] + static_cast<dlimb>(k));
+				un[i + j] = static_cast<limb>(t);
+				k = t >> 32;
+			}
+			un[j + n] = static_cast<limb>(un[j + n] + k);
+		}
+	}
+
+	/* Unnormalize the remainder. */
+	r.assign(n, 0);
+	for(std::size_t i = 0; i < n; ++i)
+		r[i] = static_cast<limb>((un[i] >> s) | (s ? static_cast<dlimb>(un[i + 1]) << (32 - s) : 0u));
+}
+
+inline src::bigint src::bigint::add(const bigint& x, const bigint& y, bool subtract){
+	if(x.is_small() && y.is_small()){
+		long long r;
+#if defined(__GNUC__) || defined(__clang__)
+		const bool overflow = subtract
+			? __builtin_sub_overflow(x.small, y.small, &r)
+			: __builtin_add_overflow(x.small, y.small, &r);
+#else
+		const bool overflow = subtract
+			? (y.small < 0 ? x.small > LLONG_MAX + y.small : x.small < LLONG_MIN + y.small)
+			: (y.small > 0 ? x.small > LLONG_MAX - y.small : x.small < LLONG_MIN - y.small);
+		if(!overflow) r = subtract ? x.small - y.small : x.small + y.small;
+#endif
+		if(!overflow){
+			bigint t;
+			t.small = r;
+			return t;
+		}
+	}
+
+	view a(x), b(y);
+	const bool bneg = subtract ? !b.neg : b.neg;
+
+	std::vector<limb> mag;
+
+	if(a.neg == bneg){
+		add_mag(a.p, a.n, b.p, b.n, mag);
+		return make(a.neg, mag);
+	}
+
+	if(cmp_mag(a.p, a.n, b.p, b.n) >= 0){
+		sub_mag(a.p, a.n, b.p, b.n, mag);
+		return make(a.neg, mag);
+	}
+
+	sub_mag(b.p, b.n, a.p, a.n, mag);
+	return make(bneg, mag);
+}
+
+inline void src::bigint::divmod(const bigint& x, const bigint& y, bigint *q, bigint *r){
+	if(!y){
+		throw std::domain_error("bigint: division by zero");
+	}
+
+	if(x.is_small() && y.is_small() && !(x.small == LLONG_MIN && y.small == -1)){
+		const long long qs = x.small / y.small;
+		const long long rs = x.small % y.small;
+
+		if(q){ *q = bigint(qs); }
+		if(r){ *r = bigint(rs); }
+		return;
+	}
+
+	view a(x), b(y);
+	std::vector<limb> qm, rm;
+
+	divmod_mag(a.p, a.n, b.p, b.n, qm, rm);
+
+	if(q) *q = make(a.neg != b.neg, qm);
+	if(r) *r = make(a.neg, rm);
+}
+
+/* Conversions [3] */
+inline src::bigint::operator double() const{
+	if(is_small()) return static_cast<double>(small);
+
+	double d = 0.0;
+	const std::size_t n = limbs.size();
+	const std::size_t top = n < 3 ? n : 3;
+
+	for(std::size_t i = 0; i < top; ++i)
+		d = d * 4294967296.0 + limbs[n - 1 - i];
+
+	d = std::ldexp(d, static_cast<int>(32 * (n - top)));
+	return negative ? -d : d;
+}
+
+template<typename T, typename>
+src::bigint::operator T() const{
+	if(is_small()){
+		if(small >= static_cast<long long>((std::numeric_limits<T>::min)()) &&
+			(small < 0 || static_cast<unsigned long long>(small) <= static_cast<unsigned long long>((std::numeric_limits<T>::max)()))){
+			return static_cast<T>(small);
+		}
+	}
+	else
+	if(!negative && limbs.size() == 2 && !std::is_signed<T>::value && sizeof(T) >= 8){
+		return static_cast<T>(static_cast<unsigned long long>(limbs[0]) | static_cast<unsigned long long>(limbs[1]) << 32);
+	}
+
+	throw std::range_error("bigint: value out of range");
+}
+
+/* Word conversions [2] */
+inline src::bigint src::bigint::from_words(bool neg, const std::uint64_t *words, std::size_t count){
+	std::vector<limb> mag(2 * count);
+
+	for(std::size_t i = 0; i < count; ++i){
+		mag[2 * i]     = static_cast<limb>(words[i]);
+		mag[2 * i + 1] = static_cast<limb>(words[i] >> 32);
+	}
+
+	return make(neg, mag);
+}
+
+inline std::vector<std::uint64_t> src::bigint::to_words() const{
+	const view v(*this);
+	std::vector<std::uint64_t> words((v.n + 1) / 2);
+
+	for(std::size_t i = 0; i < v.n; ++i)
+		words[i / 2] |= static_cast<std::uint64_t>(v.p[i]) << (i % 2 * 32);
+
+	return words;
+}
+
+/* Inspection [3] */
+inline int src::bigint::sign() const{
+	if(is_small()) return small < 0 ? -1 : small > 0 ? 1 : 0;
+	return negative ? -1 : 1;
+}
+
+inline std::size_t src::bigint::bit_length() const{
+	const view v(*this);
+	if(v.n == 0) return 0;
+
+	std::size_t bits = 32 * (v.n - 1);
+	for(limb top = v.p[v.n - 1]; top; top >>= 1) ++bits;
+
+	return bits;
+}
+
+inline std::string src::bigint::to_string() const{
+	if(is_small()) return std::to_string(small);
+
+	std::vector<limb> mag(limbs);
+	std::string s;
+
+	/* Peel off nine decimal digits at a time. */
+	while(!mag.empty()){
+		dlimb k = 0;
+		for(std::size_t j = mag.size(); j-- > 0; ){
+			const dlimb t = (k << 32) | mag[j];
+			mag[j] = static_cast<limb>(t / 1000000000u);
+			k = t % 1000000000u;
+		}
+		while(!mag.empty() && mag.back() == 0) mag.pop_back();
+
+		for(int i = 0; i < 9 && (k || !mag.empty()); ++i){
+			s.push_back(static_cast<char>('0' + k % 10));
+			k /= 10;
+		}
+	}
+
+	if(negative) s.push_back('-');
+	std::reverse(s.begin(), s.end());
+	return s;
+}
+
+/* Arithmetic assignment operators [5] */
+inline src::bigint& src::bigint::operator +=(const bigint& b){
+	return *this = add(*this, b, false);
+}
+
+inline src::bigint& src::bigint::operator -=(const bigint& b){
+	return *this = add(*this, b, true);
+}
+
+inline src::bigint& src::bigint::operator *=(const bigint& b){
+	if(is_small() && b.is_small()){
+		long long r;
+#if defined(__GNUC__) || defined(__clang__)
+		if(!__builtin_mul_overflow(small, b.small, &r)){
+			small = r;
+			return *this;
+		}
+#else
+		if(b.small == 0 || (small != LLONG_MIN && b.small != LLONG_MIN &&
+			std::llabs(small) <= LLONG_MAX / std::llabs(b.small))){
+			small = small * b.small;
+			return *this;
+		}
+#endif
+	}
+
+	view x(*this), y(b);
+
+	if(x.n == 0 || y.n == 0){
+		return *this = bigint();
+	}
+
+	std::vector<limb> mag;
+	mul_mag(x.p, x.n, y.p, y.n, mag);
+
+	return *this = make(x.neg != y.neg, mag);
+}
+
+inline src::bigint& src::bigint::operator /=(const bigint& b){
+	divmod(*this, b, this, nullptr);
+	return *this;
+}
+
+inline src::bigint& src::bigint::operator %=(const bigint& b){
+	divmod(*this, b, nullptr, this);
+	return *this;
+}
+
+/* Increment and decrement operators [4] */
+inline src::bigint& src::bigint::operator ++(){
+	return *this += bigint(1);
+}
+
+inline src::bigint& src::bigint::operator --(){
+	return *this -= bigint(1);
+}
+
+inline src::bigint src::bigint::operator ++(int){
+	bigint t(*this);
+	++(*this);
+	return t;
+}
+
+inline src::bigint src::bigint::operator --(int){
+	bigint t(*this);
+	--(*this);
+	return t;
+}
+
+/* Unary operators [3] */
+inline src::bigint src::bigint::operator -() const{
+	return add(bigint(), *this, true);
+}
+
+/* Binary operators [5] */
+inline src::bigint src::operator +(const bigint& a, const bigint& b){
+	return bigint::add(a, b, false);
+}
+
+inline src::bigint src::operator -(const bigint& a, const bigint& b){
+	return bigint::add(a, b, true);
+}
+
+inline src::bigint src::operator *(const bigint& a, const bigint& b){
+	bigint t(a);
+	t *= b;
+	return t;
+}
+
+inline src::bigint src::operator /(const bigint& a, const bigint& b){
+	bigint q;
+	bigint::divmod(a, b, &q, nullptr);
+	return q;
+}
+
+inline src::bigint src::operator %(const bigint& a, const bigint& b){
+	bigint r;
+	bigint::divmod(a, b, nullptr, &r);
+	return r;
+}
+
+/* Comparison operators [7] */
+inline int src::compare(const bigint& a, const bigint& b){
+	if(a.is_small() && b.is_small()){
+		return a.small < b.small ? -1 : a.small > b.small ? 1 : 0;
+	}
+
+	const int sa = a.sign(), sb = b.sign();
+	if(sa != sb) return sa < sb ? -1 : 1;
+
+	bigint::view x(a), y(b);
+	const int c = bigint::cmp_mag(x.p, x.n, y.p, y.n);
+	return sa < 0 ? -c : c;
+}
+
+inline bool src::operator ==(const bigint& a, const bigint& b){
+	return a.is_small() && b.is_small() ? a.small == b.small : compare(a, b) == 0;
+}
+
+inline bool src::operator !=(const bigint& a, const bigint& b){
+	return !(a == b);
+}
+
+inline bool src::operator <(const bigint& a, const bigint& b){
+	return a.is_small() && b.is_small() ? a.small < b.small : compare(a, b) < 0;
+}
+
+inline bool src::operator >(const bigint& a, const bigint& b){
+	return b < a;
+}
+
+inline bool src::operator <=(const bigint& a, const bigint& b){
+	return !(b < a);
+}
+
+inline bool src::operator >=(const bigint& a, const bigint& b){
+	return !(a < b);
+}
+
+/* Global input and output operators [2] */
+inline std::istream& src::operator >>(std::istream& is, bigint& b){
+	std::istream::sentry sentry(is);
+	if(!sentry) return is;
+
+	std::string s;
+	int c = is.peek();
+
+	if(c == '-' || c == '+'){
+		s.push_back(static_cast<char>(is.get()));
+		c = is.peek();
+	}
+
+	while(c != std::char_traits<char>::eof() && c >= '0' && c <= '9'){
+		s.push_back(static_cast<char>(is.get()));
+		c = is.peek();
+	}
+
+	if(s.empty() || s.back() < '0' || s.back() > '9'){
+		is.setstate(std::ios::failbit);
+		return is;
+	}
+
+	b = bigint(s);
+	return is;
+}
+
+inline std::ostream& src::operator <<(std::ostream& os, const bigint& b){
+	std::string s = b.to_string();
+
+	if((os.flags() & std::ios::showpos) && b.sign() >= 0){
+		s.insert(s.begin(), '+');
+	}
+
+	return os << s;
+}
+
+#endif
@@ -9,12 +9,18 @@
 #ifndef __RATIONAL_H__
 #define __RATIONAL_H__
 
+#include <charconv>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <locale>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <system_error>
 #include <cassert>
 #include <limits>
+#include <type_traits>
 
 /**
  * A namespace to enclose the C++ rational class and global helper classes and functions.
@@ -32,29 +38,156 @@ namespace src{
 			explicit bad_rational(const char *what) : std::domain_error(what){}
 	};
 
+	/**
+	 * An exception class for rationals whose terms overflow the integer type.
+	 */
+	class rational_overflow : public bad_rational{
+		public:
+			/** Default constructor. */
+			explicit rational_overflow() : bad_rational("bad rational: arithmetic overflow"){}
+
+			/** One argument constructor. */
+			explicit rational_overflow(const char *what) : bad_rational(what){}
+	};
+
+	/**
+	 * A traits class giving the narrowest built-in signed integer type wider than I,
+	 * or void when there is none (user defined types, or the widest built-in type).
+	 */
+	template<typename I, bool = std::is_integral<I>::value && std::is_signed<I>::value>
+	struct wider_integer{
+		typedef void type;
+	};
+
+	template<typename I>
+	struct wider_integer<I, true>{
+		typedef typename std::conditional<
+			(sizeof(I) < sizeof(long long)),
+			long long,
+#if defined(__SIZEOF_INT128__)
+			typename std::conditional<(sizeof(I) < sizeof(__int128)), __int128, void>::type
+#else
+			void
+#endif
+		>::type type;
+	};
+
+	/**
+	 * A class of overflow checked arithmetic on bounded integer types, throwing
+	 * rational_overflow instead of wrapping. Unbounded types are not checked.
+	 */
+	template<typename T, bool = std::numeric_limits<T>::is_bounded>
+	struct checked_arithmetic{
+		static constexpr T add(const T& a, const T& b){ return a + b; }  /**< Sum. */
+		static constexpr T sub(const T& a, const T& b){ return a - b; }  /**< Difference. */
+		static constexpr T mul(const T& a, const T& b){ return a * b; }  /**< Product. */
+		static constexpr T neg(const T& a){ return -a; }                 /**< Negation. */
+
+		template<typename J>
+		static constexpr T narrow(const J& j){ return T(j); }            /**< Conversion from a wider type. */
+	};
+
+	template<typename T>
+	struct checked_arithmetic<T, true>{
+#if defined(__GNUC__) || defined(__clang__)
+		static constexpr T add(const T& a, const T& b){
+			T r = T();
+			if(__builtin_add_overflow(a, b, &r)) throw rational_overflow();
+			return r;
+		}
+
+		static constexpr T sub(const T& a, const T& b){
+			T r = T();
+			if(__builtin_sub_overflow(a, b, &r)) throw rational_overflow();
+			return r;
+		}
+
+		static constexpr T mul(const T& a, const T& b){
+			T r = T();
+			if(__builtin_mul_overflow(a, b, &r)) throw rational_overflow();
+			return r;
+		}
+#else
+		static constexpr T add(const T& a, const T& b){
+			if(b > T(0) ? a > (std::numeric_limits<T>::max)() - b : a < (std::numeric_limits<T>::min)() - b)
+				throw rational_overflow();
+			return a + b;
+		}
+
+		static constexpr T sub(const T& a, const T& b){
+			if(b < T(0) ? a > (std::numeric_limits<T>::max)() + b : a < (std::numeric_limits<T>::min)() + b)
+				throw rational_overflow();
+			return a - b;
+		}
+
+		static constexpr T mul(const T& a, const T& b){
+			if(a != T(0) && b != T(0)){
+				const T max = (std::numeric_limits<T>::max)();
+				const T min = (std::numeric_limits<T>::min)();
+
+				if(a > T(0) ? (b > T(0) ? a > max / b : b < min / a)
+				            : (b > T(0) ? a < min / b : a < max / b))
+					throw rational_overflow();
+			}
+			return a * b;
+		}
+#endif
+
+		static constexpr T neg(const T& a){
+			if(a < -(std::numeric_limits<T>::max)()) throw rational_overflow();
+			return -a;
+		}
+
+		template<typename J>
+		static constexpr T narrow(const J& j){
+			const T t = static_cast<T>(j);
+			if(static_cast<J>(t) != j) throw rational_overflow();
+			return t;
+		}
+	};
+
+	/**
+	 * Rounding modes of the integer and decimal conversions, those of Intl.NumberFormat: towards
+	 * negative or positive infinity, towards or away from zero, then the same for ties only and
+	 * ties to even.
+	 */
+	enum class rounding{ floor, ceil, trunc, expand, half_floor, half_ceil, half_trunc, half_expand, half_even };
+
 	/**
 	 * A template based class for representing and manipulating rational numbers.
 	 */
 	template<typename I>
 	class rational{
-		private: /* Helper static functions [3] */
+		private: /* Helper static functions [7] */
 
 			/** Greatest common divisor. */
-			static I inner_gcd(I, I, const I& = I(0));
+			constexpr static I inner_gcd(I, I, const I& = I(0));
+
+			/** Greatest common divisor of built-in integers (binary algorithm). */
+			constexpr static I inner_gcd(I, I, const I&, std::true_type);
+
+			/** Greatest common divisor of user defined integers (Euclid's algorithm). */
+			constexpr static I inner_gcd(I, I, const I&, std::false_type);
+
+			/** Three-way comparison for integers with a wider companion type. */
+			constexpr static int inner_compare(const rational&, const rational&, std::true_type);
+
+			/** Three-way comparison for integers without a wider companion type. */
+			constexpr static int inner_compare(const rational&, const rational&, std::false_type);
 
 			/** Absolute value. */
-			static I inner_abs(I, const I& = I(0));
+			constexpr static I inner_abs(I, const I& = I(0));
 
 			/** Inspect the two given parameters are in normalized form. */
-			static bool is_normalized(I, I, const I& = I(0), const I& = I(1));
+			constexpr static bool is_normalized(I, I, const I& = I(0), const I& = I(1));
 
 		private: /* Helper member functions [2] */
 
 			/** Normalize the rational number i.e. no common factors and denominator is positive. */
-			void normalize();
+			constexpr void normalize();
 
 			/** Light test of normalized rational number. */
-			bool test_invariant()const;
+			constexpr bool test_invariant()const;
 
 		private:
 			I num;  /**< Numerator (normalized).*/
@@ -62,105 +195,151 @@ namespace src{
 
 		public:
 			/* Constructors [4] */
-			rational();      /**< Default constructor. */
-			rational(I);     /**< One argument constructor. */
-			rational(I, I);  /**< Two arguments constructor. */
+			constexpr rational();      /**< Default constructor. */
+			constexpr rational(I);     /**< One argument constructor. */
+			constexpr rational(I, I);  /**< Two arguments constructor. */
 
 			template<typename J>
-			explicit rational(const rational<J>&);  /**< Copy constructor. */
+			constexpr explicit rational(const rational<J>&);  /**< Copy constructor. */
 
 			/* Access to representation [2] */
-			const I& numerator() const { return num; }    /**< Get numerator. */
-			const I& denominator() const { return den; }  /**< Get denominator. */
+			constexpr const I& numerator() const { return num; }    /**< Get numerator. */
+			constexpr const I& denominator() const { return den; }  /**< Get denominator. */
 
 			/* Assignment [2] */
-			rational& operator =(const I&);        /**< Assignment from Int type. */
-			rational& assign(const I&, const I&);  /**< Assignment in place. */
+			constexpr rational& operator =(const I&);        /**< Assignment from Int type. */
+			constexpr rational& assign(const I&, const I&);  /**< Assignment in place. */
 
 			/* Arithmetic assignment operators [8] */
-			rational& operator +=(const rational<I>&);  /**< Arithmetic assignment operator += */
-			rational& operator -=(const rational<I>&);  /**< Arithmetic assignment operator -= */
-			rational& operator *=(const rational<I>&);  /**< Arithmetic assignment operator *= */
-			rational& operator /=(const rational<I>&);  /**< Arithmetic assignment operator /= */
+			constexpr rational& operator +=(const rational<I>&);  /**< Arithmetic assignment operator += */
+			constexpr rational& operator -=(const rational<I>&);  /**< Arithmetic assignment operator -= */
+			constexpr rational& operator *=(const rational<I>&);  /**< Arithmetic assignment operator *= */
+			constexpr rational& operator /=(const rational<I>&);  /**< Arithmetic assignment operator /= */
 
-			rational& operator +=(const I&);  /**< Arithmetic assignment operator += from int type. */
-			rational& operator -=(const I&);  /**< Arithmetic assignment operator -= from int type. */
-			rational& operator *=(const I&);  /**< Arithmetic assignment operator *= from int type. */
-			rational& operator /=(const I&);  /**< Arithmetic assignment operator /= from int type. */
+			constexpr rational& operator +=(const I&);  /**< Arithmetic assignment operator += from int type. */
+			constexpr rational& operator -=(const I&);  /**< Arithmetic assignment operator -= from int type. */
+			constexpr rational& operator *=(const I&);  /**< Arithmetic assignment operator *= from int type. */
+			constexpr rational& operator /=(const I&);  /**< Arithmetic assignment operator /= from int type. */
 
 			/* Increment and decrement operators [4] */
-			rational& operator ++();  /**< Pre-increment operator. */
-			rational& operator --();  /**< Pre-decrement operator. */
+			constexpr rational& operator ++();  /**< Pre-increment operator. */
+			constexpr rational& operator --();  /**< Pre-decrement operator. */
 
-			rational operator ++(int);  /**< Post-increment operator. */
-			rational operator --(int);  /**< Post-decrement operator. */
+			constexpr rational operator ++(int);  /**< Post-increment operator. */
+			constexpr rational operator --(int);  /**< Post-decrement operator. */
 
 			/* Operator not [1] */
-			bool operator !() const;  /**< Not operator. */
+			constexpr bool operator !() const;  /**< Not operator. */
 
 			/* Boolean conversion [1] */
-			operator bool () const;  /**< Boolean conversion. */
+			constexpr operator bool () const;  /**< Boolean conversion. */
+
+			/* Three-way comparison [2] */
+			constexpr int compare(const rational&) const;  /**< Three-way comparison as -1, 0 or 1. */
+			constexpr int compare(const I&) const;         /**< Three-way comparison with int type as -1, 0 or 1. */
 
 			/* Comparison operators [4] */
-			bool operator  <(const rational&) const;  /**< Comparison operator < */
-			bool operator  >(const rational&) const;  /**< Comparison operator < */
-			bool operator ==(const rational&) const;  /**< Comparison operator == */
-			bool operator !=(const rational&) const;  /**< Comparison operator != */
+			constexpr bool operator  <(const rational&) const;  /**< Comparison operator < */
+			constexpr bool operator  >(const rational&) const;  /**< Comparison operator > */
+			constexpr bool operator ==(const rational&) const;  /**< Comparison operator == */
+			constexpr bool operator !=(const rational&) const;  /**< Comparison operator != */
 
 			/* Comparison with integers [4] */
-			bool operator  <(const I&) const;  /**< Comparison operator < int type. */
-			bool operator  >(const I&) const;  /**< Comparison operator > int type. */
-			bool operator ==(const I&) const;  /**< Comparison operator == int type. */
-			bool operator !=(const I&) const;  /**< Comparison operator != int type. */
+			constexpr bool operator  <(const I&) const;  /**< Comparison operator < int type. */
+			constexpr bool operator  >(const I&) const;  /**< Comparison operator > int type. */
+			constexpr bool operator ==(const I&) const;  /**< Comparison operator == int type. */
+			constexpr bool operator !=(const I&) const;  /**< Comparison operator != int type. */
 	};
 
 	/* Global unary operators [2] */
 	template<typename I>
-	rational<I> operator +(const rational<I>&); /**< Unary operator + */
+	constexpr rational<I> operator +(const rational<I>&); /**< Unary operator + */
 
 	template<typename I>
-	rational<I> operator -(const rational<I>&); /**< Unary operator - */
+	constexpr rational<I> operator -(const rational<I>&); /**< Unary operator - */
 
 	/* Global binary operators [12] */
 	template<typename I>
-	rational<I> operator +(const rational<I>&, const rational<I>&);
+	constexpr rational<I> operator +(const rational<I>&, const rational<I>&);
 
 	template<typename I>
-	rational<I> operator +(const rational<I>&, const I&);
+	constexpr rational<I> operator +(const rational<I>&, const I&);
 
 	template<typename I>
-	rational<I> operator +(const I&, const rational<I>&);
+	constexpr rational<I> operator +(const I&, const rational<I>&);
 
 	template<typename I>
-	rational<I> operator -(const rational<I>&, const rational<I>&);
+	constexpr rational<I> operator -(const rational<I>&, const rational<I>&);
 
 	template<typename I>
-	rational<I> operator -(const rational<I>&, const I&);
+	constexpr rational<I> operator -(const rational<I>&, const I&);
 
 	template<typename I>
-	rational<I> operator -(const I&, const rational<I>&);
+	constexpr rational<I> operator -(const I&, const rational<I>&);
 
 	template<typename I>
-	rational<I> operator *(const rational<I>&, const rational<I>&);
+	constexpr rational<I> operator *(const rational<I>&, const rational<I>&);
 
 	template<typename I>
-	rational<I> operator *(const rational<I>&, const I&);
+	constexpr rational<I> operator *(const rational<I>&, const I&);
 
 	template<typename I>
-	rational<I> operator *(const I&, const rational<I>&);
+	constexpr rational<I> operator *(const I&, const rational<I>&);
 
 	template<typename I>
-	rational<I> operator /(const rational<I>&, const rational<I>&);
+	constexpr rational<I> operator /(const rational<I>&, const rational<I>&);
 
 	template<typename I>
-	rational<I> operator /(const rational<I>&, const I&);
+	constexpr rational<I> operator /(const rational<I>&, const I&);
 
 	template<typename I>
-	rational<I> operator /(const I&, const rational<I>&);
+	constexpr rational<I> operator /(const I&, const rational<I>&);
 
 	/* Global absolute value function [1] */
 	template<typename I>
-	rational<I> abs(const rational<I>&);
+	constexpr rational<I> abs(const rational<I>&);
+
+	/* Global power function [1] */
+	template<typename I>
+	constexpr rational<I> pow(const rational<I>&, long long);  /**< Integer power by repeated squaring, throwing rational_overflow. */
+
+	/* Global approximation function [1] */
+	template<typename I>
+	constexpr rational<I> limit_denominator(const rational<I>&, const I&);  /**< Closest rational with a denominator up to the bound, any integer type. */
+
+	/* Global rounding functions [5] */
+	template<typename I>
+	constexpr I floor(const rational<I>&);  /**< Largest integer not greater. */
+
+	template<typename I>
+	constexpr I ceil(const rational<I>&);   /**< Smallest integer not less. */
+
+	template<typename I>
+	constexpr I trunc(const rational<I>&);  /**< Integer part. */
+
+	template<typename I>
+	constexpr I round(const rational<I>&, rounding = rounding::half_even);  /**< Integer in the given mode, nearest with ties to even by default. */
+
+	constexpr bool inner_away(rounding, int, int, bool);  /**< Whether an inexact result is rounded away from zero, by its sign, its fraction against one half and its parity. */
+
+	/* Global greatest common divisor kernels [4] */
+	constexpr int inner_ctz(unsigned long long);  /**< Count trailing zeros of a non-zero value. */
+#if defined(__SIZEOF_INT128__)
+	constexpr int inner_ctz(unsigned __int128);   /**< Count trailing zeros of a non-zero 128-bit value. */
+#endif
+
+	template<typename I>
+	constexpr I euclid_gcd(I, I, const I& = I(0));  /**< Euclid's algorithm, any integer type. */
+
+	template<typename I>
+	constexpr I binary_gcd(I, I);  /**< Stein's binary algorithm, built-in integer types only. */
+
+	/* Global comparison kernels [2] */
+	template<typename I>
+	constexpr int cf_compare(const rational<I>&, const rational<I>&);     /**< Continued fraction expansion, any integer type. */
+
+	template<typename I>
+	constexpr int cross_compare(const rational<I>&, const rational<I>&);  /**< Widened cross multiplication, wider_integer<I> required. */
 
 	/* Global input and output operators [2] */
 	template<typename I>
@@ -169,52 +348,96 @@ namespace src{
 	template<typename I>
 	std::ostream& operator <<(std::ostream&, const rational<I>&);
 
-	/* Global type conversion function [1] */
+	/* Global input and output helpers [5] */
+	template<typename I>
+	std::istream& inner_get(std::istream&, rational<I>&, std::true_type);   /**< In place parsing, built-in integer types. */
+	template<typename I>
+	std::istream& inner_get(std::istream&, rational<I>&, std::false_type);  /**< Formatted extraction of the terms. */
+	template<typename I>
+	std::ostream& inner_put(std::ostream&, const rational<I>&, std::true_type);   /**< In place formatting, built-in integer types. */
+	template<typename I>
+	std::ostream& inner_put(std::ostream&, const rational<I>&, std::false_type);  /**< Formatted insertion of the terms. */
+
+	bool inner_plain(const std::ios_base&);  /**< Whether a stream formats integers as plain decimals in the classic locale. */
+
+	/* Global character conversion functions [5] */
+	template<typename I>
+	std::to_chars_result to_chars(char*, char*, const rational<I>&);            /**< Format as "n/d" into a buffer, built-in integer types only. */
+
+	template<typename I>
+	std::from_chars_result from_chars(const char*, const char*, rational<I>&);  /**< Parse "n/d" or "n" from a buffer, built-in integer types only. */
+
+	template<typename I>
+	std::to_chars_result to_decimal(char*, char*, const rational<I>&, int, rounding = rounding::half_even);  /**< Format with the given number of fraction digits, built-in integer types of up to 64 bits only. */
+
+	template<typename I>
+	std::to_chars_result to_decimal_expansion(char*, char*, const rational<I>&, int, bool = true);  /**< Format the exact expansion, the period in parentheses, up to the given number of fraction digits, built-in integer types of up to 64 bits only. */
+
+	constexpr int inner_next_digit(unsigned long long&, unsigned long long);  /**< The next digit of a fraction rem/den below 1, leaving the remainder in rem. */
+
+	/* Global type conversion functions [3] */
 	template<typename T, typename I>
-	T rational_cast(const rational<I>& r);
+	constexpr T rational_cast(const rational<I>& r);  /**< Correctly rounded to double for built-in integer types of up to 64 bits. */
+
+	template<typename I>
+	rational<I> from_double(double);  /**< The exact value of a finite double, built-in integer types only. */
+
+	template<typename I>
+	double to_double(const rational<I>&);  /**< Correctly rounded by long division, built-in integer types of up to 64 bits only. */
 }
 
 /* Constructors [4] */
 template<typename I>
-src::rational<I>::rational() : num(0), den(1){}
+constexpr src::rational<I>::rational() : num(0), den(1){}
 
 template<typename I>
-src::rational<I>::rational(I n) : num(n), den(1){}
+constexpr src::rational<I>::rational(I n) : num(n), den(1){}
 
 template<typename I>
-src::rational<I>::rational(I n, I d) : num(n), den(d){
+constexpr src::rational<I>::rational(I n, I d) : num(n), den(d){
 	normalize();
 }
 
 template<typename I>
 template<typename J>
-src::rational<I>::rational(const src::rational<J>& r){
-	if(is_normalized(
-			I(r.numerator()),
-			I(r.denominator())
-		)
-	){
-		num = r.numerator();
-		den = r.denominator();
-	}
-	else{
+constexpr src::rational<I>::rational(const src::rational<J>& r) : num(r.numerator()), den(r.denominator()){
+	if(!is_normalized(num, den))
 		throw bad_rational("bad rational: denormalized conversion");
-	}
 }
 
-/* Helper static functions [3] */
+/* Helper static functions [5] */
+template<typename I>
+constexpr I src::rational<I>::inner_gcd(I a, I b, const I& zero){
+	return inner_gcd(a, b, zero, typename std::is_integral<I>::type());
+}
+
+template<typename I>
+constexpr I src::rational<I>::inner_gcd(I a, I b, const I&, std::true_type){
+	return binary_gcd(a, b);
+}
+
+template<typename I>
+constexpr I src::rational<I>::inner_gcd(I a, I b, const I& zero, std::false_type){
+	return euclid_gcd(a, b, zero);
+}
+
 template<typename I>
-I src::rational<I>::inner_gcd(I a, I b, const I& zero){
-	return b == zero ? a : inner_gcd(b, a % b, zero);
+constexpr int src::rational<I>::inner_compare(const rational& a, const rational& b, std::true_type){
+	return cross_compare(a, b);
 }
 
 template<typename I>
-I src::rational<I>::inner_abs(I x, const I& zero){
+constexpr int src::rational<I>::inner_compare(const rational& a, const rational& b, std::false_type){
+	return cf_compare(a, b);
+}
+
+template<typename I>
+constexpr I src::rational<I>::inner_abs(I x, const I& zero){
 	return x < zero ? -x : +x;
 }
 
 template<typename I>
-bool src::rational<I>::is_normalized(I n, I d, const I& zero, const I& one){
+constexpr bool src::rational<I>::is_normalized(I n, I d, const I& zero, const I& one){
 	return
 		d > zero &&
 		(n != zero || d == one) &&
@@ -223,7 +446,7 @@ bool src::rational<I>::is_normalized(I n, I d, const I& zero, const I& one){
 
 /* Helper member functions [2] */
 template<typename I>
-void src::rational<I>::normalize(){
+constexpr void src::rational<I>::normalize(){
 	I zero(0);
 
 	if(den == zero) throw bad_rational();
@@ -238,12 +461,12 @@ void src::rational<I>::normalize(){
 	num /= g;
 	den /= g;
 
-	if(den < -(std::numeric_limits<I>::max)()){
+	if(std::numeric_limits<I>::is_bounded && den < -(std::numeric_limits<I>::max)()){
 		throw bad_rational("bad rational: non-zero singular denominator");
 	}
 
 	if(den < zero){
-		num = -num;
+		num = checked_arithmetic<I>::neg(num);
 		den = -den;
 	}
 
@@ -251,7 +474,7 @@ void src::rational<I>::normalize(){
 }
 
 template<typename I>
-bool src::rational<I>::test_invariant()const{
+constexpr bool src::rational<I>::test_invariant()const{
 	return
 		this->den > I(0) &&
 		inner_abs( inner_gcd(this->num, this->den) ) == I(1);
@@ -259,66 +482,106 @@ bool src::rational<I>::test_invariant()const{
 
 /* Assignment [2] */
 template<typename I>
-src::rational<I>& src::rational<I>::operator =(const I& n){
+constexpr src::rational<I>& src::rational<I>::operator =(const I& n){
 	return assign( static_cast<I>(n), static_cast<I>(1) );
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::assign(const I& n, const I& d){
+constexpr src::rational<I>& src::rational<I>::assign(const I& n, const I& d){
 	return *this = rational<I>( static_cast<I>(n), static_cast<I>(d) );
 }
 
 /* Arithmetic assignment operators [8] */
+
+/*
+ * The operators below compute the new terms in locals and assign them last, so
+ * that a rational_overflow leaves the left operand unchanged. Sums and
+ * differences build the unreduced numerator in the wider companion type when
+ * there is one, so only results that do not fit in I after reduction overflow.
+ */
 template<typename I>
-src::rational<I>& src::rational<I>::operator +=(const rational& r){
+constexpr src::rational<I>& src::rational<I>::operator +=(const rational& r){
+	typedef typename std::conditional<
+		std::is_void<typename wider_integer<I>::type>::value, I, typename wider_integer<I>::type
+	>::type W;
+
+	typedef checked_arithmetic<W> WA;
+	typedef checked_arithmetic<I> IA;
+
 	I r_num = r.numerator();
 	I r_den = r.denominator();
 
 	I g = inner_gcd(den, r_den);
 
-	den /= g;
-	num = num * (r_den / g) + r_num * den;
+	I d = den / g;
+	W n = WA::add( WA::mul(W(num), W(r_den / g)), WA::mul(W(r_num), W(d)) );
 
-	g = inner_abs( inner_gcd(num, g) );
-	num /= g;
-	den *= r_den/g;
+	if(g != I(1)){
+		g = inner_abs( inner_gcd(g, IA::narrow( n % W(g) )) );
+		n /= W(g);
+	}
+
+	d = IA::mul(d, r_den / g);
+
+	num = IA::narrow(n);
+	den = d;
 
 	return *this;
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::operator -=(const rational& r){
+constexpr src::rational<I>& src::rational<I>::operator -=(const rational& r){
+	typedef typename std::conditional<
+		std::is_void<typename wider_integer<I>::type>::value, I, typename wider_integer<I>::type
+	>::type W;
+
+	typedef checked_arithmetic<W> WA;
+	typedef checked_arithmetic<I> IA;
+
 	I r_num = r.numerator();
 	I r_den = r.denominator();
 
 	I g = inner_gcd(den, r_den);
 
-	den /= g;
-	num = num * (r_den / g) - r_num * den;
+	I d = den / g;
+	W n = WA::sub( WA::mul(W(num), W(r_den / g)), WA::mul(W(r_num), W(d)) );
 
-	g = inner_abs( inner_gcd(num, g) );
-	num /= g;
-	den *= r_den/g;
+	if(g != I(1)){
+		g = inner_abs( inner_gcd(g, IA::narrow( n % W(g) )) );
+		n /= W(g);
+	}
+
+	d = IA::mul(d, r_den / g);
+
+	num = IA::narrow(n);
+	den = d;
 
 	return *this;
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::operator *=(const rational& r){
+constexpr src::rational<I>& src::rational<I>::operator *=(const rational& r){
+	typedef checked_arithmetic<I> IA;
+
 	I r_num = r.num;
 	I r_den = r.den;
 
 	I gcd1 = inner_abs( inner_gcd(num, r_den) );
 	I gcd2 = inner_abs( inner_gcd(r_num, den) );
 
-	num = (num/gcd1) * (r_num/gcd2);
-	den = (den/gcd2) * (r_den/gcd1);
+	I n = IA::mul(num/gcd1, r_num/gcd2);
+	I d = IA::mul(den/gcd2, r_den/gcd1);
+
+	num = n;
+	den = d;
 
 	return *this;
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::operator /=(const rational& r){
+constexpr src::rational<I>& src::rational<I>::operator /=(const rational& r){
+	typedef checked_arithmetic<I> IA;
+
 	I r_num = r.num;
 	I r_den = r.den;
 
@@ -335,78 +598,92 @@ src::rational<I>& src::rational<I>::operator /=(const rational& r){
 	I gcd1 = inner_abs( inner_gcd(num, r_num) );
 	I gcd2 = inner_abs( inner_gcd(r_den, den) );
 
-	num = (num/gcd1) * (r_den/gcd2);
-	den = (den/gcd2) * (r_num/gcd1);
+	I n = IA::mul(num/gcd1, r_den/gcd2);
+	I d = IA::mul(den/gcd2, r_num/gcd1);
 
-	if(den < zero){
-		num = -num;
-		den = -den;
+	if(d < zero){
+		n = IA::neg(n);
+		d = IA::neg(d);
 	}
 
+	num = n;
+	den = d;
+
 	return *this;
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::operator +=(const I& i){
-	num += i * den;
+constexpr src::rational<I>& src::rational<I>::operator +=(const I& i){
+	typedef checked_arithmetic<I> IA;
+
+	num = IA::add(num, IA::mul(i, den));
 	return *this;
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::operator -=(const I& i){
-	num -= i * den;
+constexpr src::rational<I>& src::rational<I>::operator -=(const I& i){
+	typedef checked_arithmetic<I> IA;
+
+	num = IA::sub(num, IA::mul(i, den));
 	return *this;
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::operator *=(const I& i){
+constexpr src::rational<I>& src::rational<I>::operator *=(const I& i){
+	typedef checked_arithmetic<I> IA;
+
 	I gcd = inner_abs( inner_gcd( static_cast<I>(i), den ) );
-	num *= i / gcd;
+	num = IA::mul(num, i / gcd);
 	den /= gcd;
 	return *this;
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::operator /=(const I& i){
+constexpr src::rational<I>& src::rational<I>::operator /=(const I& i){
+	typedef checked_arithmetic<I> IA;
+
 	const I zero(0);
 
 	if(i == zero) throw bad_rational();
 	if(num == zero) return *this;
 
 	const I gcd = inner_abs( inner_gcd(num, static_cast<I>(i)) );
-	num /= gcd;
-	den *= i / gcd;
+	I n = num / gcd;
+	I d = IA::mul(den, i / gcd);
 
-	if(den < zero){
-		num = -num;
-		den = -den;
+	if(d < zero){
+		n = IA::neg(n);
+		d = IA::neg(d);
 	}
 
+	num = n;
+	den = d;
+
 	return *this;
 }
 
 /* Increment and decrement operators [4] */
 template<typename I>
-src::rational<I>& src::rational<I>::operator ++(){
-	num += den;
+constexpr src::rational<I>& src::rational<I>::operator ++(){
+	num = checked_arithmetic<I>::add(num, den);
 	return *this;
 }
 
 template<typename I>
-src::rational<I>& src::rational<I>::operator --(){
-	num -= den;
+constexpr src::rational<I>& src::rational<I>::operator --(){
+	num = checked_arithmetic<I>::sub(num, den);
 	return *this;
 }
 
 template<typename I>
-src::rational<I> src::rational<I>::operator ++(int){
+constexpr src::rational<I> src::rational<I>::operator ++(int){
 	rational t(*this);
 	++(*this);
 	return t;
 }
 
 template<typename I>
-src::rational<I> src::rational<I>::operator --(int){
+constexpr src::rational<I> src::rational<I>::operator --(int){
 	rational t(*this);
 	--(*this);
 	return t;
@@ -414,204 +691,171 @@ src::rational<I> src::rational<I>::operator --(int){
 
 /* Operator not [1] */
 template<typename I>
-bool src::rational<I>::operator !() const{
+constexpr bool src::rational<I>::operator !() const{
 	return !num;
 }
 
 /* Boolean conversion [1] */
 template<typename I>
-src::rational<I>::operator bool() const{
+constexpr src::rational<I>::operator bool() const{
 	return static_cast<bool>(num);
 }
 
-/* Comparison operators [4] */
+/* Three-way comparison [2] */
 template<typename I>
-bool src::rational<I>::operator <(const rational& r) const{
-	const I zero(0);
-
-	assert( this->den > zero );
-	assert( r.den > zero );
-
-	struct{
-		I  n, d, q, r;
-	}
-	ts = {
-		this->num,
-		this->den,
-		static_cast<I>( this->num / this->den ),
-		static_cast<I>( this->num % this->den )
-	},
-	rs = {
-		r.num,
-		r.den,
-		static_cast<I>(r.num / r.den),
-		static_cast<I>(r.num % r.den)
-	};
-
-	unsigned int reverse = 0u;
-
-	while (ts.r < zero){ ts.r += ts.d; --ts.q; }
-	while (rs.r < zero){ rs.r += rs.d; --rs.q; }
+constexpr int src::rational<I>::compare(const rational& r) const{
+	return inner_compare(*this, r,
+		std::integral_constant<bool, !std::is_void<typename wider_integer<I>::type>::value>());
+}
 
-	for( ;; ){
-		if(ts.q != rs.q){
-			return reverse ? ts.q > rs.q : ts.q < rs.q;
-		}
+template<typename I>
+constexpr int src::rational<I>::compare(const I& i) const{
+	const I zero(0);
 
-		reverse ^= 1u;
+	assert(this->den > zero);
+	I q = this->num / this->den;
+	I r = this->num % this->den;
+	while(r < zero){ r += this->den; --q; }
 
-		if(ts.r == zero || rs.r == zero){
-			break;
-		}
+	if(q < i) return -1;
+	if(i < q) return 1;
 
-		ts.n = ts.d;         ts.d = ts.r;
-		ts.q = ts.n / ts.d;  ts.r = ts.n % ts.d;
-		rs.n = rs.d;         rs.d = rs.r;
-		rs.q = rs.n / rs.d;  rs.r = rs.n % rs.d;
-	}
+	return r == zero ? 0 : 1;
+}
 
-	if(ts.r == rs.r){
-		return false;
-	}
-	else{
-		return ( ts.r != zero ) != static_cast<bool>( reverse );
-	}
+/* Comparison operators [4] */
+template<typename I>
+constexpr bool src::rational<I>::operator <(const rational& r) const{
+	return compare(r) < 0;
 }
 
 template<typename I>
-bool src::rational<I>::operator >(const rational& r) const{
-	return !(*this < r || *this == r);
+constexpr bool src::rational<I>::operator >(const rational& r) const{
+	return compare(r) > 0;
 }
 
 template<typename I>
-bool src::rational<I>::operator ==(const rational& r) const{
+constexpr bool src::rational<I>::operator ==(const rational& r) const{
 	return (num == r.numerator() && den == r.denominator());
 }
 
 template<typename I>
-bool src::rational<I>::operator !=(const rational& r) const{
+constexpr bool src::rational<I>::operator !=(const rational& r) const{
 	return (num != r.numerator() || den != r.denominator());
 }
 
 /* Comparison with integers [4] */
 template<typename I>
-bool src::rational<I>::operator <(const I& i) const{
-	const I zero(0);
-
-	assert(this->den > zero);
-	I q = this->num / this->den;
-	I r = this->num % this->den;
-	while(r < zero){ r += this->den; --q; }
-
-	return q < i;
+constexpr bool src::rational<I>::operator <(const I& i) const{
+	return compare(i) < 0;
 }
 
 template<typename I>
-bool src::rational<I>::operator >(const I& i) const{
-	return operator ==(i) ? false : !(operator <(i));
+constexpr bool src::rational<I>::operator >(const I& i) const{
+	return compare(i) > 0;
 }
 
 template<typename I>
-bool src::rational<I>::operator ==(const I& i) const{
+constexpr bool src::rational<I>::operator ==(const I& i) const{
 	return ((den == I(1)) && (num == i));
 }
 
 template<typename I>
-bool src::rational<I>::operator !=(const I& i) const{
+constexpr bool src::rational<I>::operator !=(const I& i) const{
 	return ((den != I(1)) || (num != i));
 }
 
 /* Global unary operators [2] */
 template<typename I>
-inline src::rational<I> src::operator +(const rational<I>& r){
+constexpr src::rational<I> src::operator +(const rational<I>& r){
 	return r;
 }
 
 template<typename I>
-inline src::rational<I> src::operator -(const rational<I>& r){
-	return rational<I>( static_cast<I>(-r.numerator()), r.denominator() );
+constexpr src::rational<I> src::operator -(const rational<I>& r){
+	return rational<I>( checked_arithmetic<I>::neg(r.numerator()), r.denominator() );
 }
 
 /* Global binary operators [12] */
 template<typename I>
-inline src::rational<I> src::operator+ (const rational<I>& a, const rational<I>& b){
+constexpr src::rational<I> src::operator+ (const rational<I>& a, const rational<I>& b){
 	rational<I> t(a);
 	t += b;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator+ (const rational<I>& r, const I& i){
+constexpr src::rational<I> src::operator+ (const rational<I>& r, const I& i){
 	rational<I> t(r);
 	t += i;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator+ (const I& i, const rational<I>& r){
+constexpr src::rational<I> src::operator+ (const I& i, const rational<I>& r){
 	rational<I> t(r);
 	t += i;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator- (const rational<I>& a, const rational<I>& b){
+constexpr src::rational<I> src::operator- (const rational<I>& a, const rational<I>& b){
 	rational<I> t(a);
 	t -= b;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator- (const rational<I>& r, const I& i){
+constexpr src::rational<I> src::operator- (const rational<I>& r, const I& i){
 	rational<I> t(r);
 	t -= i;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator- (const I& i, const rational<I>& r){
+constexpr src::rational<I> src::operator- (const I& i, const rational<I>& r){
 	rational<I> t(r);
 	t -= i;
 	return -t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator* (const rational<I>& a, const rational<I>& b){
+constexpr src::rational<I> src::operator* (const rational<I>& a, const rational<I>& b){
 	rational<I> t(a);
 	t *= b;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator* (const rational<I>& r, const I& i){
+constexpr src::rational<I> src::operator* (const rational<I>& r, const I& i){
 	rational<I> t(r);
 	t *= i;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator* (const I& i, const rational<I>& r){
+constexpr src::rational<I> src::operator* (const I& i, const rational<I>& r){
 	rational<I> t(r);
 	t *= i;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator/ (const rational<I>& a, const rational<I>& b){
+constexpr src::rational<I> src::operator/ (const rational<I>& a, const rational<I>& b){
 	rational<I> t(a);
 	t /= b;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator/ (const rational<I>& r, const I& i){
+constexpr src::rational<I> src::operator/ (const rational<I>& r, const I& i){
 	rational<I> t(r);
 	t /= i;
 	return t;
 }
 
 template<typename I>
-inline src::rational<I> src::operator/ (const I& i, const rational<I>& r){
+constexpr src::rational<I> src::operator/ (const I& i, const rational<I>& r){
 	rational<I> t(i);
 	t /= r;
 	return t;
@@ -619,13 +863,399 @@ inline src::rational<I> src::operator/ (const I& i, const rational<I>& r){
 
 /* Global absolute value function [1] */
 template<typename I>
-inline src::rational<I> src::abs(const rational<I>& r){
+constexpr src::rational<I> src::abs(const rational<I>& r){
 	return r.numerator() >= I(0) ? r : -r;
 }
 
+/* Global power function [1] */
+template<typename I>
+constexpr src::rational<I> src::pow(const rational<I>& r, long long e){
+	typedef checked_arithmetic<I> IA;
+
+	const I zero(0), one(1);
+
+	I b_num = r.numerator();
+	I b_den = r.denominator();
+
+	if(e < 0){
+		if(b_num == zero) throw bad_rational();
+
+		I t = b_num;
+		b_num = b_den;
+		b_den = t;
+
+		if(b_den < zero){
+			b_num = IA::neg(b_num);
+			b_den = IA::neg(b_den);
+		}
+	}
+
+	/* Magnitude of the exponent, the most negative one included. */
+	unsigned long long n = e < 0 ? 0ULL - static_cast<unsigned long long>(e) : static_cast<unsigned long long>(e);
+
+	/* Powers of coprime terms are coprime, so no intermediate normalization is needed. */
+	I num(one), den(one);
+
+	while(n){
+		if(n & 1ULL){
+			num = IA::mul(num, b_num);
+			den = IA::mul(den, b_den);
+		}
+
+		/* The base is not squared past the last bit, so only a result that overflows throws. */
+		if(n >>= 1){
+			b_num = IA::mul(b_num, b_num);
+			b_den = IA::mul(b_den, b_den);
+		}
+	}
+
+	return rational<I>(num, den);
+}
+
+/* Global approximation function [1] */
+template<typename I>
+constexpr src::rational<I> src::limit_denominator(const rational<I>& r, const I& bound){
+	typedef checked_arithmetic<I> IA;
+
+	const I zero(0), one(1);
+
+	if(bound < one) throw std::invalid_argument("limit_denominator: bound less than 1");
+	if(!(bound < r.denominator())) return r;
+
+	/*
+	 * Convergents p0/q0 and p1/q1 of the continued fraction of n/d, taken while the denominator
+	 * is within the bound, the remainders n and d being |q0·x - p0|·den and |q1·x - p1|·den.
+	 */
+	I p0(zero), q0(one), p1(one), q1(zero);
+	I n = r.numerator(), d = r.denominator();
+
+	for(;;){
+		I a = n / d;
+		if(n % d != zero && n < zero) a = a - one;  /* Floor, only the first term may be negative. */
+
+		const I q2 = q0 + a * q1;
+		if(bound < q2) break;
+
+		const I p2 = IA::add(p0, IA::mul(a, p1));
+
+		p0 = p1; q0 = q1;
+		p1 = p2; q1 = q2;
+
+		const I t = n - a * d;
+		n = d; d = t;
+	}
+
+	/* The semiconvergent of largest denominator within the bound, on the other side of x than p1/q1. */
+	const I k = (bound - q0) / q1;
+	const I pk = IA::add(p0, IA::mul(k, p1)), qk = q0 + k * q1;
+
+	/* The distances d/(den·q1) and (n - k·d)/(den·qk), compared without overflow. */
+	if(rational<I>(d, q1).compare(rational<I>(n - k * d, qk)) <= 0)
+		return rational<I>(p1, q1);
+
+	return rational<I>(pk, qk);
+}
+
+/* Global rounding functions [5] */
+template<typename I>
+constexpr I src::floor(const rational<I>& r){
+	return round(r, rounding::floor);
+}
+
+template<typename I>
+constexpr I src::ceil(const rational<I>& r){
+	return round(r, rounding::ceil);
+}
+
+template<typename I>
+constexpr I src::trunc(const rational<I>& r){
+	return r.numerator() / r.denominator();
+}
+
+template<typename I>
+constexpr I src::round(const rational<I>& r, rounding mode){
+	const I zero(0), one(1);
+
+	const I q = r.numerator() / r.denominator();
+	const I m = r.numerator() % r.denominator();
+
+	if(m == zero) return q;
+
+	/* The fraction |m|/den against one half, as |m| against den - |m|, both below den. */
+	const I a = m < zero ? -m : m;
+	const I b = r.denominator() - a;
+
+	const int sign = m < zero ? -1 : 1;
+	const int half = a < b ? -1 : b < a ? 1 : 0;
+
+	/* With den > 1 the quotient is at most half of the numerator, so stepping it cannot overflow. */
+	if(!inner_away(mode, sign, half, q % I(2) != zero)) return q;
+
+	return sign < 0 ? q - one : q + one;
+}
+
+constexpr bool src::inner_away(rounding mode, int sign, int half, bool odd){
+	switch(mode){
+		case rounding::floor:       return sign < 0;
+		case rounding::ceil:        return sign > 0;
+		case rounding::trunc:       return false;
+		case rounding::expand:      return true;
+		case rounding::half_floor:  return half > 0 || (half == 0 && sign < 0);
+		case rounding::half_ceil:   return half > 0 || (half == 0 && sign > 0);
+		case rounding::half_trunc:  return half > 0;
+		case rounding::half_expand: return half >= 0;
+		case rounding::half_even:   return half > 0 || (half == 0 && odd);
+	}
+
+	return false;
+}
+
+/* Global greatest common divisor kernels [4] */
+constexpr int src::inner_ctz(unsigned long long x){
+	assert(x != 0);
+
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(x);
+#else
+	int n = 0;
+	while(!(x & 1u)){ x >>= 1; ++n; }
+	return n;
+#endif
+}
+
+#if defined(__SIZEOF_INT128__)
+constexpr int src::inner_ctz(unsigned __int128 x){
+	const unsigned long long low = static_cast<unsigned long long>(x);
+
+	return low ? inner_ctz(low) : 64 + inner_ctz( static_cast<unsigned long long>(x >> 64) );
+}
+#endif
+
+template<typename I>
+constexpr I src::euclid_gcd(I a, I b, const I& zero){
+	return b == zero ? a : euclid_gcd(b, a % b, zero);
+}
+
+/*
+ * The magnitudes are processed as unsigned values so that the most negative
+ * value of I is handled; the result is always non-negative. Each step replaces
+ * the hardware division of Euclid's algorithm by a subtraction and a shift,
+ * the smaller odd operand subtracted from the larger so that no value leaves
+ * the range of the unsigned type, signed or unsigned I alike.
+ */
+template<typename I>
+constexpr I src::binary_gcd(I a, I b){
+	static_assert(std::is_integral<I>::value, "binary_gcd: built-in integer type required");
+
+	typedef typename std::make_unsigned<I>::type U;
+
+	/* The argument type of inner_ctz, wide enough for U. */
+	typedef typename std::conditional<(sizeof(U) > sizeof(unsigned long long)), U, unsigned long long>::type C;
+
+	U u = a < I(0) ? static_cast<U>(U(0) - static_cast<U>(a)) : static_cast<U>(a);
+	U v = b < I(0) ? static_cast<U>(U(0) - static_cast<U>(b)) : static_cast<U>(b);
+
+	if(u == 0) return static_cast<I>(v);
+	if(v == 0) return static_cast<I>(u);
+
+	const int uz = inner_ctz(static_cast<C>(u));
+	const int vz = inner_ctz(static_cast<C>(v));
+	const int shift = uz < vz ? uz : vz;
+
+	u >>= uz;
+	v >>= vz;
+
+	for( ;; ){
+
+		/* Both operands are odd here, their difference even. */
+		if(u > v){
+			const U t = u;
+			u = v;
+			v = t;
+		}
+
+		v = static_cast<U>(v - u);
+
+		if(v == 0) break;
+
+		v >>= inner_ctz(static_cast<C>(v));
+	}
+
+	return static_cast<I>(u << shift);
+}
+
+/* Global comparison kernels [2] */
+
+/*
+ * Compares the continued fraction expansions of the two rationals term by term,
+ * one division and one modulo per term, without forming any product; suitable
+ * for integer types that have no wider companion type.
+ */
+template<typename I>
+constexpr int src::cf_compare(const rational<I>& a, const rational<I>& b){
+	const I zero(0);
+
+	assert( a.denominator() > zero );
+	assert( b.denominator() > zero );
+
+	if(a.numerator() == b.numerator() && a.denominator() == b.denominator()){
+		return 0;
+	}
+
+	struct{
+		I  n, d, q, r;
+	}
+	ts = {
+		a.numerator(),
+		a.denominator(),
+		static_cast<I>( a.numerator() / a.denominator() ),
+		static_cast<I>( a.numerator() % a.denominator() )
+	},
+	rs = {
+		b.numerator(),
+		b.denominator(),
+		static_cast<I>( b.numerator() / b.denominator() ),
+		static_cast<I>( b.numerator() % b.denominator() )
+	};
+
+	unsigned int reverse = 0u;
+
+	while (ts.r < zero){ ts.r += ts.d; --ts.q; }
+	while (rs.r < zero){ rs.r += rs.d; --rs.q; }
+
+	for( ;; ){
+		if(ts.q != rs.q){
+			return (reverse ? ts.q > rs.q : ts.q < rs.q) ? -1 : 1;
+		}
+
+		reverse ^= 1u;
+
+		if(ts.r == zero || rs.r == zero){
+			break;
+		}
+
+		ts.n = ts.d;         ts.d = ts.r;
+		ts.q = ts.n / ts.d;  ts.r = ts.n % ts.d;
+		rs.n = rs.d;         rs.d = rs.r;
+		rs.q = rs.n / rs.d;  rs.r = rs.n % rs.d;
+	}
+
+	if(ts.r == rs.r){
+		return 0;
+	}
+	else{
+		return ( ts.r != zero ) != static_cast<bool>( reverse ) ? -1 : 1;
+	}
+}
+
+/*
+ * Decides a/b <=> c/d by the sign of a*d - c*b; both products are exact in the
+ * wider companion type, so a single multiplication per side is enough.
+ */
+template<typename I>
+constexpr int src::cross_compare(const rational<I>& a, const rational<I>& b){
+	typedef typename wider_integer<I>::type W;
+
+	static_assert(!std::is_void<W>::value, "cross_compare: wider integer type required");
+
+	if(a.denominator() == b.denominator()){
+		return (a.numerator() > b.numerator()) - (a.numerator() < b.numerator());
+	}
+
+	const W l = static_cast<W>(a.numerator()) * b.denominator();
+	const W r = static_cast<W>(b.numerator()) * a.denominator();
+
+	return (l > r) - (l < r);
+}
+
 /* Global input and output operators [2] */
 template<typename I>
 std::istream& src::operator >>(std::istream& is, rational<I>& r){
+	return inner_get(is, r, typename std::is_integral<I>::type());
+}
+
+template<typename I>
+std::ostream& src::operator <<(std::ostream& os, const rational<I>& r){
+	return inner_put(os, r, typename std::is_integral<I>::type());
+}
+
+/* Global input and output helpers [5] */
+template<typename I>
+std::istream& src::inner_get(std::istream& is, rational<I>& r, std::true_type){
+	typedef std::char_traits<char> traits;
+
+	if((is.flags() & std::ios::basefield) != std::ios::dec || !inner_plain(is))
+		return inner_get(is, r, std::false_type());
+
+	std::istream::sentry guard(is);
+	if(!guard) return is;
+
+	/* Signs, digits and the solidus of two terms, a plus sign dropped. */
+	char buf[2 * (std::numeric_limits<I>::digits10 + 2) + 1];
+	std::size_t len = 0;
+
+	std::ios::iostate state = std::ios::goodbit;
+	std::streambuf *sb = is.rdbuf();
+	int c = sb->sgetc();
+
+	for(int term = 0; term < 2 && !state; term++){
+		if(term == 1){
+			if(c != '/'){
+				state |= std::ios::failbit;
+				break;
+			}
+			buf[len++] = '/';
+			c = sb->snextc();
+		}
+
+		if(c == '-' || c == '+'){
+			if(c == '-') buf[len++] = '-';
+			c = sb->snextc();
+		}
+
+		std::size_t digits = 0;
+		for( ; c >= '0' && c <= '9'; c = sb->snextc(), digits++){
+			if(len < sizeof(buf))
+				buf[len++] = static_cast<char>(c);
+			else
+				state |= std::ios::failbit;
+		}
+
+		if(!digits) state |= std::ios::failbit;
+	}
+
+	if(traits::eq_int_type(c, traits::eof()))
+		state |= std::ios::eofbit;
+
+	if(!(state & std::ios::failbit)){
+		rational<I> t;
+		const std::from_chars_result res = from_chars(buf, buf + len, t);
+
+		/* The terms are well formed, so only a zero denominator is an invalid argument. */
+		if(res.ec == std::errc::invalid_argument){
+			try{
+				is.setstate(state | std::ios::failbit);
+			}
+			catch( ... ) {}
+
+			if( is.exceptions() & std::ios::failbit )
+				throw bad_rational();
+
+			return is;
+		}
+
+		if(res.ec == std::errc())
+			r = t;
+		else
+			state |= std::ios::failbit;
+	}
+
+	is.setstate(state);
+	return is;
+}
+
+template<typename I>
+std::istream& src::inner_get(std::istream& is, rational<I>& r, std::false_type){
     using std::ios;
 
     I n = I(0), d = I(1);
@@ -658,7 +1288,19 @@ std::istream& src::operator >>(std::istream& is, rational<I>& r){
 }
 
 template<typename I>
-std::ostream& src::operator <<(std::ostream& os, const rational<I>& r){
+std::ostream& src::inner_put(std::ostream& os, const rational<I>& r, std::true_type){
+	if(!inner_plain(os) || (os.flags() & std::ios::showpos) ||
+	   (os.width() > 0 && (os.flags() & std::ios::adjustfield) == std::ios::internal))
+		return inner_put(os, r, std::false_type());
+
+	char buf[2 * (std::numeric_limits<I>::digits10 + 2) + 1];
+	const std::to_chars_result res = to_chars(buf, buf + sizeof(buf), r);
+
+	return os << std::string_view(buf, res.ptr - buf);
+}
+
+template<typename I>
+std::ostream& src::inner_put(std::ostream& os, const rational<I>& r, std::false_type){
 	std::ostringstream ss;
 
 	ss.copyfmt( os );
@@ -679,11 +1321,334 @@ std::ostream& src::operator <<(std::ostream& os, const rational<I>& r){
 	return os << ss.str() + tail;
 }
 
-/* Global type conversion function [1] */
+inline bool src::inner_plain(const std::ios_base& s){
+	const std::ios::fmtflags base = s.flags() & std::ios::basefield;
+
+	return (base == std::ios::dec || base == std::ios::fmtflags(0)) && s.getloc() == std::locale::classic();
+}
+
+/* Global character conversion functions [5] */
+template<typename I>
+std::to_chars_result src::to_chars(char* first, char* last, const rational<I>& r){
+	static_assert(std::is_integral<I>::value, "to_chars: built-in integer types only");
+
+	std::to_chars_result res = std::to_chars(first, last, r.numerator());
+
+	if(res.ec != std::errc()) return res;
+	if(res.ptr == last) return { last, std::errc::value_too_large };
+
+	*res.ptr++ = '/';
+
+	return std::to_chars(res.ptr, last, r.denominator());
+}
+
+template<typename I>
+std::from_chars_result src::from_chars(const char* first, const char* last, rational<I>& r){
+	static_assert(std::is_integral<I>::value, "from_chars: built-in integer types only");
+
+	I n = I(0), d = I(1);
+
+	std::from_chars_result res = std::from_chars(first, last, n);
+	if(res.ec != std::errc()) return res;
+
+	/* A solidus not followed by an integer is not part of the match. */
+	if(res.ptr != last && *res.ptr == '/'){
+		const std::from_chars_result den = std::from_chars(res.ptr + 1, last, d);
+
+		if(den.ec == std::errc::result_out_of_range) return den;
+		if(den.ec == std::errc()) res = den;
+	}
+
+	/* Unlike a missing numerator, a zero denominator leaves the end of the match in ptr. */
+	if(d == I(0)) return { res.ptr, std::errc::invalid_argument };
+
+	try{
+		r = rational<I>(n, d);
+	}
+	catch(bad_rational&){
+		return { res.ptr, std::errc::result_out_of_range };
+	}
+
+	return res;
+}
+
+template<typename I>
+std::to_chars_result src::to_decimal(char* first, char* last, const rational<I>& r, int digits, rounding mode){
+	static_assert(std::is_integral<I>::value && std::numeric_limits<I>::digits <= 64, "to_decimal: built-in integer types of up to 64 bits only");
+
+	if(digits < 0) throw std::invalid_argument("to_decimal: negative number of digits");
+
+	typedef unsigned long long U;
+
+	const int sign = r.numerator() < I(0) ? -1 : 1;
+
+	const U a = sign < 0 ? U(0) - static_cast<U>(r.numerator()) : static_cast<U>(r.numerator());
+	const U b = static_cast<U>(r.denominator());
+
+	char *p = first;
+
+	if(sign < 0){
+		if(p == last) return { last, std::errc::value_too_large };
+		*p++ = '-';
+	}
+
+	char *const lead = p;
+
+	std::to_chars_result res = std::to_chars(p, last, a / b);
+	if(res.ec != std::errc()) return res;
+
+	p = res.ptr;
+
+	U rem = a % b;
+
+	if(digits > 0){
+		if(last - p <= digits) return { last, std::errc::value_too_large };
+
+		*p++ = '.';
+
+		for(int i = 0; i < digits; i++)
+			*p++ = static_cast<char>('0' + inner_next_digit(rem, b));
+	}
+
+	if(rem != 0){
+		const int half = rem < b - rem ? -1 : b - rem < rem ? 1 : 0;
+
+		if(inner_away(mode, sign, half, (p[-1] - '0') % 2 != 0)){
+
+			/* Carry through the trailing nines, a carry out of the leading digit adding a new one. */
+			char *q = p;
+
+			for(;;){
+				if(q == lead){
+					if(p == last) return { last, std::errc::value_too_large };
+
+					for(char *t = p++; t != lead; t--) *t = t[-1];
+					*lead = '1';
+					break;
+				}
+
+				if(*--q == '.') continue;
+
+				if(*q != '9'){
+					++*q;
+					break;
+				}
+
+				*q = '0';
+			}
+		}
+	}
+
+	/* A value rounded to zero has no sign. */
+	if(sign < 0){
+		bool zero = true;
+
+		for(const char *t = lead; t != p && zero; t++) zero = *t == '0' || *t == '.';
+
+		if(zero){
+			for(char *t = first; t + 1 != p; t++) *t = t[1];
+			p--;
+		}
+	}
+
+	return { p, std::errc() };
+}
+
+template<typename I>
+std::to_chars_result src::to_decimal_expansion(char* first, char* last, const rational<I>& r, int max_digits, bool repeat){
+	static_assert(std::is_integral<I>::value && std::numeric_limits<I>::digits <= 64, "to_decimal_expansion: built-in integer types of up to 64 bits only");
+
+	if(max_digits < 0) throw std::invalid_argument("to_decimal_expansion: negative number of digits");
+
+	typedef unsigned long long U;
+
+	const bool negative = r.numerator() < I(0);
+
+	const U a = negative ? U(0) - static_cast<U>(r.numerator()) : static_cast<U>(r.numerator());
+	const U b = static_cast<U>(r.denominator());
+
+	char *p = first;
+
+	if(negative){
+		if(p == last) return { last, std::errc::value_too_large };
+		*p++ = '-';
+	}
+
+	std::to_chars_result res = std::to_chars(p, last, a / b);
+	if(res.ec != std::errc()) return res;
+
+	p = res.ptr;
+
+	U rem = a % b;
+	if(rem == 0) return { p, std::errc() };
+
+	/* With den = 2^i·5^j·m and m coprime to 10, the period starts after max(i, j) digits. */
+	int twos = 0, fives = 0;
+
+	for(U d = b; d % 2 == 0; d /= 2) twos++;
+	for(U d = b; d % 5 == 0; d /= 5) fives++;
+
+	const int prefix = twos > fives ? twos : fives;
+
+	if(p == last) return { last, std::errc::value_too_large };
+	*p++ = '.';
+
+	char *const point = p;
+	char *open = nullptr;
+
+	U start = 0;
+
+	/*
+	 * Each digit is written as it is found. The remainder after the prefix comes back after one
+	 * period, the multiplicative order of 10 modulo m, which closes the parentheses.
+	 */
+	for(int i = 0; i < max_digits && rem != 0; i++){
+		if(repeat && i == prefix){
+			if(p == last) return { last, std::errc::value_too_large };
+
+			open = p;
+			*p++ = '(';
+			start = rem;
+		}
+
+		if(p == last) return { last, std::errc::value_too_large };
+		*p++ = static_cast<char>('0' + inner_next_digit(rem, b));
+
+		if(open && rem == start){
+			if(p == last) return { last, std::errc::value_too_large };
+
+			*p++ = ')';
+			return { p, std::errc() };
+		}
+	}
+
+	if(rem == 0) return { p, std::errc() };
+
+	/* A truncated expansion, its parenthesis dropped and an ellipsis appended. */
+	if(open){
+		for(char *t = open; t + 1 != p; t++) *t = t[1];
+		p--;
+	}
+
+	if(p == point) p--;
+
+	if(last - p < 3) return { last, std::errc::value_too_large };
+
+	for(int k = 0; k < 3; k++) *p++ = '.';
+
+	return { p, std::errc() };
+}
+
+constexpr int src::inner_next_digit(unsigned long long& rem, unsigned long long den){
+
+	/* The digit 10·rem/den and the remainder 10·rem mod den, by additions kept below 2·den <= 2^64. */
+	unsigned long long acc = 0;
+	int digit = 0;
+
+	for(int k = 0; k < 10; k++){
+		if(acc >= den - rem){
+			acc -= den - rem;
+			digit++;
+		}
+		else
+			acc += rem;
+	}
+
+	rem = acc;
+	return digit;
+}
+
+/* Global type conversion functions [3] */
 template<typename T, typename I>
-inline T src::rational_cast(const rational<I>& r){
+constexpr T src::rational_cast(const rational<I>& r){
+
+	/* Terms held exactly by a double are divided with a single rounding, wider ones rounded by to_double. */
+	if constexpr(std::is_same<T, double>::value && std::is_integral<I>::value &&
+		std::numeric_limits<I>::digits > std::numeric_limits<double>::digits && std::numeric_limits<I>::digits <= 64){
+
+		const I limit = I(1) << std::numeric_limits<double>::digits;
+
+		if(r.numerator() > limit || r.numerator() < -limit || r.denominator() > limit)
+			return to_double(r);
+	}
 
 	return static_cast<T>(r.numerator()) / static_cast<T>(r.denominator());
 }
 
+template<typename I>
+src::rational<I> src::from_double(double x){
+	static_assert(std::is_integral<I>::value, "from_double: built-in integer types only");
+
+	if(std::isnan(x)) throw std::invalid_argument("from_double: not a number");
+	if(std::isinf(x)) throw rational_overflow();
+
+	if(x == 0.0) return rational<I>();
+
+	/* x = m·2^e with the 53 bit significand m an integer, then m odd so that m/2^-e is in lowest terms. */
+	int e;
+	long long m = static_cast<long long>(std::ldexp(std::frexp(x, &e), std::numeric_limits<double>::digits));
+	e -= std::numeric_limits<double>::digits;
+
+	for( ; m % 2 == 0; m /= 2) e++;
+
+	if(m < (std::numeric_limits<I>::min)() || m > (std::numeric_limits<I>::max)())
+		throw rational_overflow();
+
+	const int digits = std::numeric_limits<I>::digits;
+
+	if(e < 0){
+		if(-e >= digits) throw rational_overflow();
+		return rational<I>(I(m), I(I(1) << -e));
+	}
+
+	/* An integer, held by I when within [-2^digits, 2^digits), the bounds being exact doubles. */
+	const double bound = std::ldexp(1.0, digits);
+
+	if(x >= bound || x < -bound) throw rational_overflow();
+
+	return rational<I>(static_cast<I>(x));
+}
+
+template<typename I>
+double src::to_double(const rational<I>& r){
+	static_assert(std::is_integral<I>::value && std::numeric_limits<I>::digits <= 64, "to_double: built-in integer types of up to 64 bits only");
+
+	typedef unsigned long long U;
+
+	const bool negative = r.numerator() < I(0);
+
+	U a = negative ? U(0) - static_cast<U>(r.numerator()) : static_cast<U>(r.numerator());
+	const U b = static_cast<U>(r.denominator());
+
+	if(a == 0) return 0.0;
+
+	/* The quotient a/b = (m + f)·2^e, m taking 64 bits by long division, f in [0, 1) non-zero when the remainder is. */
+	const U top = U(1) << 63;
+
+	U m = a / b, rem = a % b;
+	int e = 0;
+
+	for( ; m < top; e--){
+		rem <<= 1;  /* rem < b <= 2^63, so no bit is lost. */
+		m <<= 1;
+
+		if(rem >= b){
+			rem -= b;
+			m |= 1;
+		}
+	}
+
+	/* Round to the 53 bit significand, to nearest with ties to even. */
+	const int drop = 64 - std::numeric_limits<double>::digits;
+	const U low = m & ((U(1) << drop) - 1), half = U(1) << (drop - 1);
+
+	m >>= drop;
+	e += drop;
+
+	if(low > half || (low == half && (rem != 0 || (m & 1)))) m++;
+
+	const double x = std::ldexp(static_cast<double>(m), e);
+	return negative ? -x : x;
+}
+
 #endif
@@ -0,0 +1,242 @@
+/**
+ * @file    rational_accumulator.h
+ * @author  Essam A. El-Sherif
+ * @version v1.0.0
+ *
+ * A C++ header that defines a template based class 'rational_accumulator' for long running sums and products
+ * of rational numbers, deferring the normalization of its terms until its value is read.
+ */
+
+#ifndef __RATIONAL_ACCUMULATOR_H__
+#define __RATIONAL_ACCUMULATOR_H__
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "rational.h"
+
+/**
+ * A namespace to enclose the C++ rational class and global helper classes and functions.
+ */
+namespace src{
+
+	/**
+	 * A template based class accumulating sums and products of rational numbers.
+	 *
+	 * The terms are kept unreduced in the next wider built-in integer type where there is one.
+	 * Bounded terms are reduced only when an operation would overflow them, unbounded terms
+	 * once every few operations to keep them short; the value is normalized when it is read.
+	 */
+	template<typename I>
+	class rational_accumulator{
+		private:
+			typedef typename wider_integer<I>::type W;
+
+			/** Integer type of the unreduced terms. */
+			typedef typename std::conditional<std::is_void<W>::value, I, W>::type T;
+
+			typedef checked_arithmetic<T> TA;
+
+			/** Number of operations between reductions of unbounded terms. */
+			static const std::size_t period = 32;
+
+		private: /* Helper functions [6] */
+
+			/** Greatest common divisor of the terms. */
+			static T inner_gcd(const T&, const T&, std::true_type);
+			static T inner_gcd(const T&, const T&, std::false_type);
+
+			/** Reduce the terms to lowest terms with a positive denominator. */
+			static void inner_reduce(T&, T&);
+
+			/** Accumulate a sum or a product of unreduced terms, with the strong exception guarantee. */
+			void inner_add(const T&, const T&);
+			void inner_mul(const T&, const T&);
+
+			/** Count an operation, reducing unbounded terms periodically. */
+			void inner_tick();
+
+		public:
+			/* Constructors [2] */
+			rational_accumulator();                            /**< Zero. */
+			explicit rational_accumulator(const rational<I>&); /**< Initial value. */
+
+			/* Arithmetic assignment operators [4] */
+			rational_accumulator& operator +=(const rational<I>&);
+			rational_accumulator& operator -=(const rational<I>&);
+			rational_accumulator& operator *=(const rational<I>&);
+			rational_accumulator& operator /=(const rational<I>&);
+
+			/* Access [3] */
+			rational<I> value() const;      /**< Normalized value, throwing rational_overflow if its terms do not fit in I. */
+			void reduce();                  /**< Reduce the terms now. */
+			void reset(const rational<I>& = rational<I>()); /**< Restart from the given value. */
+
+		private:
+			T num;                /**< Numerator (unreduced). */
+			T den;                /**< Denominator (unreduced, positive). */
+			std::size_t pending;  /**< Operations since the last reduction. */
+	};
+}
+
+/* Constructors [2] */
+template<typename I>
+src::rational_accumulator<I>::rational_accumulator() : num(0), den(1), pending(0){}
+
+template<typename I>
+src::rational_accumulator<I>::rational_accumulator(const rational<I>& r) : num(r.numerator()), den(r.denominator()), pending(0){}
+
+/* Helper functions [6] */
+template<typename I>
+typename src::rational_accumulator<I>::T src::rational_accumulator<I>::inner_gcd(const T& a, const T& b, std::true_type){
+	return binary_gcd(a, b);
+}
+
+template<typename I>
+typename src::rational_accumulator<I>::T src::rational_accumulator<I>::inner_gcd(const T& a, const T& b, std::false_type){
+	T g = euclid_gcd(a, b, T(0));
+	return g < T(0) ? T(-g) : g;
+}
+
+template<typename I>
+void src::rational_accumulator<I>::inner_reduce(T& n, T& d){
+	const T g = inner_gcd(n, d, typename std::is_integral<T>::type());
+
+	if(g != T(1)){
+		n /= g;
+		d /= g;
+	}
+}
+
+template<typename I>
+void src::rational_accumulator<I>::inner_add(const T& r_num, const T& r_den){
+	T n = T(0), d = den;
+
+	/* Common and dividing denominators do not grow the terms. */
+	if(r_den == den)
+		n = TA::add(num, r_num);
+	else
+	if(den % r_den == T(0))
+		n = TA::add(num, TA::mul(r_num, T(den / r_den)));
+	else{
+		n = TA::add(TA::mul(num, r_den), TA::mul(r_num, den));
+		d = TA::mul(den, r_den);
+	}
+
+	num = n;
+	den = d;
+}
+
+template<typename I>
+void src::rational_accumulator<I>::inner_mul(const T& r_num, const T& r_den){
+	T n = TA::mul(num, r_num);
+	T d = TA::mul(den, r_den);
+
+	if(d < T(0)){
+		n = TA::neg(n);
+		d = TA::neg(d);
+	}
+
+	num = n;
+	den = d;
+}
+
+template<typename I>
+void src::rational_accumulator<I>::inner_tick(){
+	if(!std::numeric_limits<T>::is_bounded && ++pending >= period)
+		reduce();
+}
+
+/* Arithmetic assignment operators [4] */
+template<typename I>
+src::rational_accumulator<I>& src::rational_accumulator<I>::operator +=(const rational<I>& r){
+	const T r_num(r.numerator()), r_den(r.denominator());
+
+	try{
+		inner_add(r_num, r_den);
+	}
+	catch(const rational_overflow&){
+		reduce();
+		inner_add(r_num, r_den);
+	}
+
+	inner_tick();
+	return *this;
+}
+
+template<typename I>
+src::rational_accumulator<I>& src::rational_accumulator<I>::operator -=(const rational<I>& r){
+	const T r_num = TA::neg(T(r.numerator())), r_den(r.denominator());
+
+	try{
+		inner_add(r_num, r_den);
+	}
+	catch(const rational_overflow&){
+		reduce();
+		inner_add(r_num, r_den);
+	}
+
+	inner_tick();
+	return *this;
+}
+
+template<typename I>
+src::rational_accumulator<I>& src::rational_accumulator<I>::operator *=(const rational<I>& r){
+	const T r_num(r.numerator()), r_den(r.denominator());
+
+	try{
+		inner_mul(r_num, r_den);
+	}
+	catch(const rational_overflow&){
+		reduce();
+		inner_mul(r_num, r_den);
+	}
+
+	inner_tick();
+	return *this;
+}
+
+template<typename I>
+src::rational_accumulator<I>& src::rational_accumulator<I>::operator /=(const rational<I>& r){
+	if(r.numerator() == I(0)) throw bad_rational();
+
+	const T r_num(r.denominator()), r_den(r.numerator());
+
+	try{
+		inner_mul(r_num, r_den);
+	}
+	catch(const rational_overflow&){
+		reduce();
+		inner_mul(r_num, r_den);
+	}
+
+	inner_tick();
+	return *this;
+}
+
+/* Access [3] */
+template<typename I>
+src::rational<I> src::rational_accumulator<I>::value() const{
+	typedef checked_arithmetic<I> IA;
+
+	T n = num, d = den;
+	inner_reduce(n, d);
+
+	return rational<I>(IA::narrow(n), IA::narrow(d));
+}
+
+template<typename I>
+void src::rational_accumulator<I>::reduce(){
+	inner_reduce(num, den);
+	pending = 0;
+}
+
+template<typename I>
+void src::rational_accumulator<I>::reset(const rational<I>& r){
+	num = r.numerator();
+	den = r.denominator();
+	pending = 0;
+}
+
+#endif // __RATIONAL_ACCUMULATOR_H__
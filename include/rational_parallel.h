@@ -0,0 +1,249 @@
+/**
+ * @file    rational_parallel.h
+ * @author  Essam A. El-Sherif
+ * @version v1.0.0
+ *
+ * A C++ header that defines a thread pool and parallel reductions over arrays of rational numbers.
+ */
+
+#ifndef __RATIONAL_PARALLEL_H__
+#define __RATIONAL_PARALLEL_H__
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "rational.h"
+#include "rational_accumulator.h"
+
+/**
+ * A namespace to enclose the C++ rational class and global helper classes and functions.
+ */
+namespace src{
+
+	/**
+	 * Reductions over arrays of rational numbers.
+	 */
+	enum class reduction{ sum, product, min, max };
+
+	/**
+	 * Number of elements reduced sequentially by a single task. It does not depend on the number
+	 * of threads, so the partial results and the order they are combined in never do either.
+	 */
+	const std::size_t reduce_chunk = 4096;
+
+	/**
+	 * A fixed size pool of worker threads running batches of indexed tasks.
+	 */
+	class thread_pool{
+		public:
+			/* Constructors [1] */
+			explicit thread_pool(std::size_t = std::thread::hardware_concurrency());
+
+			thread_pool(const thread_pool&) = delete;
+			thread_pool& operator =(const thread_pool&) = delete;
+
+			~thread_pool();
+
+			/* Inspection [1] */
+			std::size_t size() const;  /**< Number of worker threads. */
+
+			/* Execution [1] */
+			void run(std::size_t, const std::function<void(std::size_t)>&);  /**< Run tasks 0..n-1 and wait for them, rethrowing the exception of the first failed task. */
+
+		private: /* Helper functions [2] */
+			void inner_work();                 /**< Worker thread loop. */
+			bool inner_next(std::unique_lock<std::mutex>&);  /**< Run the next pending task, if there is one. */
+
+		private:
+			std::vector<std::thread> workers;
+
+			std::mutex serial;                 /**< Serializes concurrent calls to run. */
+			std::mutex mutex;                  /**< Guards the state of the current batch. */
+			std::condition_variable wake;      /**< Signals workers of a new batch or of stopping. */
+			std::condition_variable done;      /**< Signals the completion of the current batch. */
+
+			const std::function<void(std::size_t)> *job;
+			std::size_t tasks;                 /**< Number of tasks in the current batch. */
+			std::size_t next;                  /**< Next task to start. */
+			std::size_t pending;               /**< Tasks started but not yet completed, or not yet started. */
+			std::size_t failed;                /**< Index of the first failed task, or tasks. */
+			std::exception_ptr error;          /**< Exception of the first failed task. */
+			bool stopping;
+	};
+
+	/* Global reductions [4] */
+	template<typename I>
+	rational<I> reduce_combine(const rational<I>&, const rational<I>&, reduction);
+	template<typename I>
+	rational<I> reduce_sequential(const rational<I>*, std::size_t, reduction);
+	template<typename I>
+	rational<I> reduce_tree(std::vector< rational<I> >&, reduction);
+	template<typename I>
+	rational<I> parallel_reduce(thread_pool&, const rational<I>*, std::size_t, reduction);
+}
+
+/* Constructors [1] */
+inline src::thread_pool::thread_pool(std::size_t n)
+	: job(nullptr), tasks(0), next(0), pending(0), failed(0), stopping(false){
+
+	workers.reserve(n);
+	for(std::size_t i = 0; i < n; i++)
+		workers.emplace_back(&thread_pool::inner_work, this);
+}
+
+inline src::thread_pool::~thread_pool(){
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+
+	for(std::thread& t : workers)
+		t.join();
+}
+
+/* Inspection [1] */
+inline std::size_t src::thread_pool::size() const{
+	return workers.size();
+}
+
+/* Execution [1] */
+inline void src::thread_pool::run(std::size_t n, const std::function<void(std::size_t)>& f){
+	std::lock_guard<std::mutex> serialize(serial);
+	std::unique_lock<std::mutex> lock(mutex);
+
+	job = &f;
+	tasks = pending = failed = n;
+	next = 0;
+	error = nullptr;
+
+	wake.notify_all();
+
+	/* The calling thread takes part, so a pool without workers runs the tasks inline. */
+	while(inner_next(lock));
+	done.wait(lock, [this]{ return pending == 0; });
+
+	job = nullptr;
+
+	if(error){
+		std::exception_ptr e = error;
+		error = nullptr;
+		std::rethrow_exception(e);
+	}
+}
+
+/* Helper functions [2] */
+inline void src::thread_pool::inner_work(){
+	std::unique_lock<std::mutex> lock(mutex);
+
+	for( ;; ){
+		wake.wait(lock, [this]{ return stopping || next < tasks; });
+		if(stopping) return;
+
+		while(inner_next(lock));
+	}
+}
+
+inline bool src::thread_pool::inner_next(std::unique_lock<std::mutex>& lock){
+	if(next >= tasks) return false;
+
+	const std::size_t i = next++;
+
+	lock.unlock();
+
+	std::exception_ptr e;
+	try{
+		(*job)(i);
+	}
+	catch(...){
+		e = std::current_exception();
+	}
+
+	lock.lock();
+
+	if(e && i < failed){
+		failed = i;
+		error = e;
+	}
+
+	if(--pending == 0)
+		done.notify_all();
+
+	return true;
+}
+
+/* Global reductions [4] */
+template<typename I>
+src::rational<I> src::reduce_combine(const rational<I>& a, const rational<I>& b, reduction op){
+	switch(op){
+		case reduction::sum:     return a + b;
+		case reduction::product: return a * b;
+		case reduction::min:     return b < a ? b : a;
+		case reduction::max:     return a < b ? b : a;
+	}
+	return a;
+}
+
+template<typename I>
+src::rational<I> src::reduce_sequential(const rational<I>* first, std::size_t n, reduction op){
+	if(op == reduction::sum || op == reduction::product){
+		rational_accumulator<I> acc(rational<I>(op == reduction::sum ? I(0) : I(1)));
+
+		for(std::size_t i = 0; i < n; i++){
+			if(op == reduction::sum)
+				acc += first[i];
+			else
+				acc *= first[i];
+		}
+
+		return acc.value();
+	}
+
+	if(n == 0) throw std::invalid_argument("reduce: empty range");
+
+	rational<I> r = first[0];
+	for(std::size_t i = 1; i < n; i++)
+		r = reduce_combine(r, first[i], op);
+
+	return r;
+}
+
+template<typename I>
+src::rational<I> src::reduce_tree(std::vector< rational<I> >& v, reduction op){
+	if(v.empty()) return reduce_sequential<I>(nullptr, 0, op);
+
+	/* Pairwise levels, the odd element out carried over to the next level. */
+	for(std::size_t n = v.size(); n > 1; n = (n + 1) / 2){
+		for(std::size_t i = 0; i < n / 2; i++)
+			v[i] = reduce_combine(v[2 * i], v[2 * i + 1], op);
+
+		if(n % 2)
+			v[n / 2] = v[n - 1];
+	}
+
+	return v[0];
+}
+
+template<typename I>
+src::rational<I> src::parallel_reduce(thread_pool& pool, const rational<I>* first, std::size_t n, reduction op){
+	const std::size_t chunks = (n + reduce_chunk - 1) / reduce_chunk;
+
+	std::vector< rational<I> > partial(chunks);
+
+	pool.run(chunks, [&](std::size_t i){
+		const std::size_t begin = i * reduce_chunk;
+		const std::size_t count = n - begin < reduce_chunk ? n - begin : reduce_chunk;
+
+		partial[i] = reduce_sequential(first + begin, count, op);
+	});
+
+	return reduce_tree(partial, op);
+}
+
+#endif // __RATIONAL_PARALLEL_H__
@@ -0,0 +1,551 @@
+/**
+ * @file    rational_vector.h
+ * @author  Essam A. El-Sherif
+ * @version v1.0.0
+ *
+ * A C++ header that defines a template based container class 'rational_vector' storing rational numbers
+ * as separate contiguous arrays of numerators and denominators, with elementwise batch operations.
+ */
+
+#ifndef __RATIONAL_VECTOR_H__
+#define __RATIONAL_VECTOR_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "rational.h"
+
+/**
+ * A namespace to enclose the C++ rational class and global helper classes and functions.
+ */
+namespace src{
+
+	/**
+	 * A template based container class of rational numbers in structure of arrays layout.
+	 *
+	 * The elementwise operations compute the wide products and the cancelling gcds of a
+	 * block of elements first, vectorized with AVX2 for 32-bit integers where available,
+	 * then combine them per element. Integer types without a wider built-in type fall
+	 * back to the scalar rational operators.
+	 *
+	 * The same operations apply to external arrays of normalized numerators and denominators
+	 * through the static functions, storing normalized results. The results may be stored
+	 * over the operands, but not over arrays partially overlapping them, and are left
+	 * partially stored by an overflow.
+	 */
+	template<typename I>
+	class rational_vector{
+		private:
+			typedef typename wider_integer<I>::type W;
+
+			/** Whether the batch kernels can widen through long long. */
+			typedef std::integral_constant<bool, std::is_same<W, long long>::value> is_widened;
+
+			/** Whether the AVX2 kernels apply. */
+			typedef std::integral_constant<bool,
+#if defined(__AVX2__)
+				std::is_same<I, std::int32_t>::value
+#else
+				false
+#endif
+			> is_simd;
+
+			/** Elementwise operations. */
+			enum operation{ op_add, op_sub, op_mul, op_div };
+
+		private: /* Helper static functions [11] */
+
+			/** AVX2 kernels, returning the number of leading elements processed. */
+			static std::size_t simd_mul(const I*, const I*, long long*, std::size_t, std::true_type);
+			static std::size_t simd_mul(const I*, const I*, long long*, std::size_t, std::false_type);
+			static std::size_t simd_gcd(const I*, const I*, long long*, std::size_t, std::true_type);
+			static std::size_t simd_gcd(const I*, const I*, long long*, std::size_t, std::false_type);
+			static std::size_t simd_compare(const I*, const I*, const I*, const I*, int*, std::size_t, std::true_type);
+			static std::size_t simd_compare(const I*, const I*, const I*, const I*, int*, std::size_t, std::false_type);
+
+			/** Elementwise wide products of two arrays. */
+			static void inner_mul(const I*, const I*, long long*, std::size_t);
+
+			/** Elementwise greatest common divisors of two arrays. */
+			static void inner_gcd(const I*, const I*, long long*, std::size_t);
+
+			/** Elementwise three-way comparison, by wide cross products or by the scalar rational comparison. */
+			static void inner_compare(const I*, const I*, const I*, const I*, int*, std::size_t, std::true_type);
+			static void inner_compare(const I*, const I*, const I*, const I*, int*, std::size_t, std::false_type);
+
+			/** Elementwise operation, by wide products and a single reduction per element or by the scalar rational operators. */
+			static void inner_apply(operation, const I*, const I*, const I*, const I*, I*, I*, std::size_t, std::true_type);
+			static void inner_apply(operation, const I*, const I*, const I*, const I*, I*, I*, std::size_t, std::false_type);
+
+			/** Elementwise operation of two containers of equal size. */
+			void inner_apply(operation, const rational_vector&);
+
+		public:
+			/* Constructors [3] */
+			rational_vector();                                     /**< Empty container. */
+			explicit rational_vector(std::size_t);                 /**< Container of zeros. */
+			rational_vector(std::initializer_list< rational<I> >); /**< Container of the listed rationals. */
+
+			/* Capacity [4] */
+			std::size_t size() const;  /**< Number of elements. */
+			bool empty() const;        /**< Whether there are no elements. */
+			void reserve(std::size_t); /**< Reserve storage. */
+			void clear();              /**< Remove all elements. */
+
+			/* Element access [5] */
+			rational<I> operator [](std::size_t) const;  /**< Element by value. */
+			void set(std::size_t, const rational<I>&);   /**< Replace an element. */
+			void push_back(const rational<I>&);          /**< Append an element. */
+			const I* numerators() const;                 /**< Contiguous normalized numerators. */
+			const I* denominators() const;               /**< Contiguous normalized denominators. */
+
+			/* Elementwise arithmetic assignment operators [4] */
+			rational_vector& operator +=(const rational_vector&);
+			rational_vector& operator -=(const rational_vector&);
+			rational_vector& operator *=(const rational_vector&);
+			rational_vector& operator /=(const rational_vector&);
+
+			/* Elementwise comparison [1] */
+			std::vector<int> compare(const rational_vector&) const;
+
+			/* Elementwise operations on external arrays [5] */
+			static void add(const I*, const I*, const I*, const I*, I*, I*, std::size_t);  /**< Sums, as numerators and denominators of both operands then the result. */
+			static void sub(const I*, const I*, const I*, const I*, I*, I*, std::size_t);  /**< Differences. */
+			static void mul(const I*, const I*, const I*, const I*, I*, I*, std::size_t);  /**< Products. */
+			static void div(const I*, const I*, const I*, const I*, I*, I*, std::size_t);  /**< Quotients, throwing bad_rational before storing any if a divisor is zero. */
+			static void compare(const I*, const I*, const I*, const I*, int*, std::size_t); /**< Three-way comparisons as -1, 0 or 1. */
+
+		private:
+			std::vector<I> num;  /**< Numerators (normalized). */
+			std::vector<I> den;  /**< Denominators (normalized). */
+	};
+
+	/* Global elementwise binary operators [4] */
+	template<typename I>
+	rational_vector<I> operator +(const rational_vector<I>&, const rational_vector<I>&);
+	template<typename I>
+	rational_vector<I> operator -(const rational_vector<I>&, const rational_vector<I>&);
+	template<typename I>
+	rational_vector<I> operator *(const rational_vector<I>&, const rational_vector<I>&);
+	template<typename I>
+	rational_vector<I> operator /(const rational_vector<I>&, const rational_vector<I>&);
+}
+
+/* Constructors [3] */
+template<typename I>
+src::rational_vector<I>::rational_vector(){}
+
+template<typename I>
+src::rational_vector<I>::rational_vector(std::size_t n) : num(n, I(0)), den(n, I(1)){}
+
+template<typename I>
+src::rational_vector<I>::rational_vector(std::initializer_list< rational<I> > list){
+	reserve(list.size());
+	for(const rational<I>& r : list)
+		push_back(r);
+}
+
+/* Helper static functions [8] */
+template<typename I>
+std::size_t src::rational_vector<I>::simd_mul(const I* a, const I* b, long long* r, std::size_t n, std::true_type){
+	std::size_t i = 0;
+
+#if defined(__AVX2__)
+	for( ; i + 4 <= n; i += 4){
+		const __m256i x = _mm256_cvtepi32_epi64( _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)) );
+		const __m256i y = _mm256_cvtepi32_epi64( _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)) );
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_mul_epi32(x, y));
+	}
+#endif
+
+	return i;
+}
+
+template<typename I>
+std::size_t src::rational_vector<I>::simd_mul(const I*, const I*, long long*, std::size_t, std::false_type){
+	return 0;
+}
+
+template<typename I>
+std::size_t src::rational_vector<I>::simd_gcd(const I* a, const I* b, long long* r, std::size_t n, std::true_type){
+	std::size_t i = 0;
+
+#if defined(__AVX2__)
+	const __m256i zero = _mm256_setzero_si256();
+
+	/* Trailing zeros of each lane from the exponent of its lowest set bit, huge for a zero lane. */
+	auto ctz = [zero](__m256i x){
+		const __m256i low = _mm256_and_si256(x, _mm256_sub_epi32(zero, x));
+		const __m256i exp = _mm256_srli_epi32(_mm256_castps_si256( _mm256_cvtepi32_ps(low) ), 23);
+
+		return _mm256_sub_epi32(_mm256_and_si256(exp, _mm256_set1_epi32(0xff)), _mm256_set1_epi32(127));
+	};
+
+	/* Binary gcd of unsigned magnitudes in lockstep, the lanes being done once their v is zero. */
+	for( ; i + 8 <= n; i += 8){
+		__m256i u = _mm256_abs_epi32( _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)) );
+		__m256i v = _mm256_abs_epi32( _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)) );
+
+		u = _mm256_blendv_epi8(u, v, _mm256_cmpeq_epi32(u, zero));
+
+		const __m256i shift = ctz(_mm256_or_si256(u, v));
+
+		u = _mm256_srlv_epi32(u, ctz(u));
+		v = _mm256_srlv_epi32(v, ctz(v));
+
+		while(!_mm256_testz_si256(v, v)){
+			v = _mm256_blendv_epi8(v, u, _mm256_cmpeq_epi32(v, zero));
+
+			const __m256i m = _mm256_min_epu32(u, v);
+
+			v = _mm256_sub_epi32(_mm256_max_epu32(u, v), m);
+			u = m;
+			v = _mm256_srlv_epi32(v, ctz(v));
+		}
+
+		u = _mm256_sllv_epi32(u, shift);
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_cvtepu32_epi64( _mm256_castsi256_si128(u) ));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i + 4), _mm256_cvtepu32_epi64( _mm256_extracti128_si256(u, 1) ));
+	}
+#endif
+
+	return i;
+}
+
+template<typename I>
+std::size_t src::rational_vector<I>::simd_gcd(const I*, const I*, long long*, std::size_t, std::false_type){
+	return 0;
+}
+
+template<typename I>
+std::size_t src::rational_vector<I>::simd_compare(const I* an, const I* ad, const I* bn, const I* bd, int* r, std::size_t n, std::true_type){
+	std::size_t i = 0;
+
+#if defined(__AVX2__)
+	const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+	for( ; i + 4 <= n; i += 4){
+		const __m256i xn = _mm256_cvtepi32_epi64( _mm_loadu_si128(reinterpret_cast<const __m128i*>(an + i)) );
+		const __m256i xd = _mm256_cvtepi32_epi64( _mm_loadu_si128(reinterpret_cast<const __m128i*>(ad + i)) );
+		const __m256i yn = _mm256_cvtepi32_epi64( _mm_loadu_si128(reinterpret_cast<const __m128i*>(bn + i)) );
+		const __m256i yd = _mm256_cvtepi32_epi64( _mm_loadu_si128(reinterpret_cast<const __m128i*>(bd + i)) );
+
+		const __m256i x = _mm256_mul_epi32(xn, yd);
+		const __m256i y = _mm256_mul_epi32(yn, xd);
+
+		/* (x > y) - (x < y), the comparison masks being all ones when true. */
+		const __m256i c = _mm256_sub_epi64(_mm256_cmpgt_epi64(y, x), _mm256_cmpgt_epi64(x, y));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), _mm256_castsi256_si128( _mm256_permutevar8x32_epi32(c, even) ));
+	}
+#endif
+
+	return i;
+}
+
+template<typename I>
+std::size_t src::rational_vector<I>::simd_compare(const I*, const I*, const I*, const I*, int*, std::size_t, std::false_type){
+	return 0;
+}
+
+template<typename I>
+void src::rational_vector<I>::inner_mul(const I* a, const I* b, long long* r, std::size_t n){
+	for(std::size_t i = simd_mul(a, b, r, n, is_simd()); i < n; i++)
+		r[i] = static_cast<long long>(a[i]) * b[i];
+}
+
+template<typename I>
+void src::rational_vector<I>::inner_gcd(const I* a, const I* b, long long* r, std::size_t n){
+	for(std::size_t i = simd_gcd(a, b, r, n, is_simd()); i < n; i++)
+		r[i] = binary_gcd(static_cast<long long>(a[i]), static_cast<long long>(b[i]));
+}
+
+template<typename I>
+void src::rational_vector<I>::inner_compare(const I* an, const I* ad, const I* bn, const I* bd, int* r, std::size_t n, std::true_type){
+	for(std::size_t i = simd_compare(an, ad, bn, bd, r, n, is_simd()); i < n; i++){
+		const long long x = static_cast<long long>(an[i]) * bd[i];
+		const long long y = static_cast<long long>(bn[i]) * ad[i];
+
+		r[i] = (x > y) - (x < y);
+	}
+}
+
+template<typename I>
+void src::rational_vector<I>::inner_compare(const I* an, const I* ad, const I* bn, const I* bd, int* r, std::size_t n, std::false_type){
+	for(std::size_t i = 0; i < n; i++)
+		r[i] = rational<I>(an[i], ad[i]).compare( rational<I>(bn[i], bd[i]) );
+}
+
+template<typename I>
+void src::rational_vector<I>::inner_apply(operation op, const I* pan, const I* pad, const I* pbn, const I* pbd, I* rn, I* rd, std::size_t n, std::true_type){
+	typedef checked_arithmetic<long long> WA;
+	typedef checked_arithmetic<I> IA;
+
+	const std::size_t block = 256;
+
+	long long x[block], y[block], z[block], g[block], h[block];
+
+	if(op == op_div)
+		for(std::size_t i = 0; i < n; i++)
+			if(pbn[i] == I(0)) throw bad_rational();
+
+	for(std::size_t k = 0; k < n; k += block){
+		const std::size_t m = n - k < block ? n - k : block;
+
+		const I *an = pan + k, *ad = pad + k;
+		const I *bn = pbn + k, *bd = pbd + k;
+
+		/* Unreduced terms of the block, x/z for products and quotients and (x +/- y)/z for sums,
+		 * and the gcds cancelling them as the scalar operators do. */
+		switch(op){
+			case op_add:
+			case op_sub:
+				inner_mul(an, bd, x, m);
+				inner_mul(bn, ad, y, m);
+				inner_mul(ad, bd, z, m);
+				inner_gcd(ad, bd, g, m);
+				break;
+			case op_mul:
+				inner_mul(an, bn, x, m);
+				inner_mul(ad, bd, z, m);
+				inner_gcd(an, bd, g, m);
+				inner_gcd(bn, ad, h, m);
+				break;
+			case op_div:
+				inner_mul(an, bd, x, m);
+				inner_mul(ad, bn, z, m);
+				inner_gcd(an, bn, g, m);
+				inner_gcd(ad, bd, h, m);
+				break;
+		}
+
+		for(std::size_t i = 0; i < m; i++){
+			long long p = op == op_add ? WA::add(x[i], y[i]) : op == op_sub ? WA::sub(x[i], y[i]) : x[i];
+			long long q = z[i];
+
+			if(op == op_add || op == op_sub){
+				/* Coprime denominators leave the sum in lowest terms. */
+				if(g[i] != 1){
+					const I f1 = static_cast<I>(g[i]);
+					const I d1 = ad[i] / f1;
+					const I d2 = bd[i] / f1;
+
+					p = static_cast<long long>(an[i]) * d2;
+					p = op == op_add ? WA::add(p, static_cast<long long>(bn[i]) * d1) : WA::sub(p, static_cast<long long>(bn[i]) * d1);
+
+					const I f2 = binary_gcd(static_cast<I>(p % f1), f1);
+
+					p /= f2;
+					q = static_cast<long long>(d1) * (bd[i] / f2);
+				}
+			}
+			else{
+				const long long f = g[i] * h[i];
+
+				if(f != 1){
+					p /= f;
+					q /= f;
+				}
+
+				if(q < 0){
+					p = -p;
+					q = -q;
+				}
+			}
+
+			/* Every operand of the element is read by now, the result may overwrite them. */
+			rn[k + i] = IA::narrow(p);
+			rd[k + i] = IA::narrow(q);
+		}
+	}
+}
+
+template<typename I>
+void src::rational_vector<I>::inner_apply(operation op, const I* an, const I* ad, const I* bn, const I* bd, I* rn, I* rd, std::size_t n, std::false_type){
+	if(op == op_div)
+		for(std::size_t i = 0; i < n; i++)
+			if(bn[i] == I(0)) throw bad_rational();
+
+	for(std::size_t i = 0; i < n; i++){
+		rational<I> a(an[i], ad[i]);
+		const rational<I> b(bn[i], bd[i]);
+
+		switch(op){
+			case op_add: a += b; break;
+			case op_sub: a -= b; break;
+			case op_mul: a *= b; break;
+			case op_div: a /= b; break;
+		}
+
+		rn[i] = a.numerator();
+		rd[i] = a.denominator();
+	}
+}
+
+template<typename I>
+void src::rational_vector<I>::inner_apply(operation op, const rational_vector& r){
+	if(r.size() != size()) throw std::invalid_argument("rational_vector: size mismatch");
+
+	/* Into new arrays, leaving the container unchanged by an overflow. */
+	std::vector<I> rn(size()), rd(size());
+	inner_apply(op, num.data(), den.data(), r.num.data(), r.den.data(), rn.data(), rd.data(), size(), is_widened());
+
+	num.swap(rn);
+	den.swap(rd);
+}
+
+/* Capacity [4] */
+template<typename I>
+std::size_t src::rational_vector<I>::size() const{
+	return num.size();
+}
+
+template<typename I>
+bool src::rational_vector<I>::empty() const{
+	return num.empty();
+}
+
+template<typename I>
+void src::rational_vector<I>::reserve(std::size_t n){
+	num.reserve(n);
+	den.reserve(n);
+}
+
+template<typename I>
+void src::rational_vector<I>::clear(){
+	num.clear();
+	den.clear();
+}
+
+/* Element access [5] */
+template<typename I>
+src::rational<I> src::rational_vector<I>::operator [](std::size_t i) const{
+	return rational<I>(num[i], den[i]);
+}
+
+template<typename I>
+void src::rational_vector<I>::set(std::size_t i, const rational<I>& r){
+	num[i] = r.numerator();
+	den[i] = r.denominator();
+}
+
+template<typename I>
+void src::rational_vector<I>::push_back(const rational<I>& r){
+	num.push_back(r.numerator());
+	try{
+		den.push_back(r.denominator());
+	}
+	catch(...){
+		num.pop_back();
+		throw;
+	}
+}
+
+template<typename I>
+const I* src::rational_vector<I>::numerators() const{
+	return num.data();
+}
+
+template<typename I>
+const I* src::rational_vector<I>::denominators() const{
+	return den.data();
+}
+
+/* Elementwise arithmetic assignment operators [4] */
+template<typename I>
+src::rational_vector<I>& src::rational_vector<I>::operator +=(const rational_vector& r){
+	inner_apply(op_add, r);
+	return *this;
+}
+
+template<typename I>
+src::rational_vector<I>& src::rational_vector<I>::operator -=(const rational_vector& r){
+	inner_apply(op_sub, r);
+	return *this;
+}
+
+template<typename I>
+src::rational_vector<I>& src::rational_vector<I>::operator *=(const rational_vector& r){
+	inner_apply(op_mul, r);
+	return *this;
+}
+
+template<typename I>
+src::rational_vector<I>& src::rational_vector<I>::operator /=(const rational_vector& r){
+	inner_apply(op_div, r);
+	return *this;
+}
+
+/* Elementwise comparison [1] */
+template<typename I>
+std::vector<int> src::rational_vector<I>::compare(const rational_vector& r) const{
+	if(r.size() != size()) throw std::invalid_argument("rational_vector: size mismatch");
+
+	std::vector<int> v(size());
+	inner_compare(num.data(), den.data(), r.num.data(), r.den.data(), v.data(), size(), is_widened());
+
+	return v;
+}
+
+/* Elementwise operations on external arrays [5] */
+template<typename I>
+void src::rational_vector<I>::add(const I* an, const I* ad, const I* bn, const I* bd, I* rn, I* rd, std::size_t n){
+	inner_apply(op_add, an, ad, bn, bd, rn, rd, n, is_widened());
+}
+
+template<typename I>
+void src::rational_vector<I>::sub(const I* an, const I* ad, const I* bn, const I* bd, I* rn, I* rd, std::size_t n){
+	inner_apply(op_sub, an, ad, bn, bd, rn, rd, n, is_widened());
+}
+
+template<typename I>
+void src::rational_vector<I>::mul(const I* an, const I* ad, const I* bn, const I* bd, I* rn, I* rd, std::size_t n){
+	inner_apply(op_mul, an, ad, bn, bd, rn, rd, n, is_widened());
+}
+
+template<typename I>
+void src::rational_vector<I>::div(const I* an, const I* ad, const I* bn, const I* bd, I* rn, I* rd, std::size_t n){
+	inner_apply(op_div, an, ad, bn, bd, rn, rd, n, is_widened());
+}
+
+template<typename I>
+void src::rational_vector<I>::compare(const I* an, const I* ad, const I* bn, const I* bd, int* r, std::size_t n){
+	inner_compare(an, ad, bn, bd, r, n, is_widened());
+}
+
+/* Global elementwise binary operators [4] */
+template<typename I>
+src::rational_vector<I> src::operator +(const rational_vector<I>& a, const rational_vector<I>& b){
+	rational_vector<I> r(a);
+	return r += b;
+}
+
+template<typename I>
+src::rational_vector<I> src::operator -(const rational_vector<I>& a, const rational_vector<I>& b){
+	rational_vector<I> r(a);
+	return r -= b;
+}
+
+template<typename I>
+src::rational_vector<I> src::operator *(const rational_vector<I>& a, const rational_vector<I>& b){
+	rational_vector<I> r(a);
+	return r *= b;
+}
+
+template<typename I>
+src::rational_vector<I> src::operator /(const rational_vector<I>& a, const rational_vector<I>& b){
+	rational_vector<I> r(a);
+	return r /= b;
+}
+
+#endif // __RATIONAL_VECTOR_H__
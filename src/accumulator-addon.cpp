@@ -0,0 +1,229 @@
+/**
+ * @file    accumulator-addon.cpp
+ * @version v1.0.0
+ * @author  Essam A. El-Sherif
+ */
+
+#include "accumulator-addon.h"
+
+namespace addon{
+
+	using v8::Context;
+	using v8::ObjectTemplate;
+}
+
+void addon::WrappedAccumulator::Init(Local<Object> exports, AddonData *addonData){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = exports->GetIsolate();
+
+	/* Context of the currently running JavaScript instance. */
+	Local<Context> context = isolate->GetCurrentContext();
+
+	const char* className = "Accumulator";
+
+	/* The state of this environment, passed to every callback. */
+	Local<External> data = External::New(isolate, addonData);
+
+	Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, guarded<WrappedAccumulator::New>, data);
+
+	tpl->SetClassName(
+		String::NewFromUtf8(isolate, className).ToLocalChecked()
+	);
+
+	Local<ObjectTemplate> otpl = tpl->InstanceTemplate();
+	otpl->SetInternalFieldCount(1);
+
+	setPrototypeMethod(tpl, "add", guarded<Add>, data);
+	setPrototypeMethod(tpl, "sub", guarded<Sub>, data);
+	setPrototypeMethod(tpl, "mul", guarded<Mul>, data);
+	setPrototypeMethod(tpl, "div", guarded<Div>, data);
+
+	setPrototypeMethod(tpl, "value", guarded<GetValue>, data);
+	setPrototypeMethod(tpl, "reset", guarded<Reset>, data);
+
+	addonData->accumulatorConstructor.Reset(isolate, tpl->GetFunction(context).ToLocalChecked());
+
+	exports->Set(
+		context,
+		String::NewFromUtf8(isolate, className).ToLocalChecked(),
+		tpl->GetFunction(context).ToLocalChecked()
+	).Check();
+}
+
+void addon::WrappedAccumulator::New(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	/* Context of the currently running JavaScript instance. */
+	Local<Context> context = isolate->GetCurrentContext();
+
+	// Invoked as plain function `Accumulator(...)`, turn into construct call.
+	if(!args.IsConstructCall()){
+		Local<Function> cons = Local<Function>::New(isolate, AddonData::From(args)->accumulatorConstructor);
+
+		/* An exception thrown by the constructor stays pending for the caller. */
+		Local<Object> instance;
+
+		switch(args.Length()){
+			case 0:
+				if(cons->NewInstance(context, 0, nullptr).ToLocal(&instance))
+					args.GetReturnValue().Set(instance);
+			break;
+			case 1: {
+				Local<Value> argv[] = { args[0] };
+				if(cons->NewInstance(context, 1, argv).ToLocal(&instance))
+					args.GetReturnValue().Set(instance);
+			}
+			break;
+			default:
+				throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		}
+		return;
+	}
+
+	WrappedAccumulator *obj = nullptr;
+	rational<long> r;
+
+	switch(args.Length()){
+		case 0:
+			obj = new WrappedAccumulator();
+		break;
+
+		case 1:
+			if(!toRational(isolate, args[0], r)) return;
+			obj = new WrappedAccumulator(r);
+		break;
+
+		default:
+			throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+			return;
+	}
+
+	obj->Wrap(args.This());
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedAccumulator::Add(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedAccumulator *ptrWrappedAccumulator = ObjectWrap::Unwrap<WrappedAccumulator>(args.Holder());
+	rational<long> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toRational(isolate, args[0], r)) return;
+	ptrWrappedAccumulator->accumulator += r;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedAccumulator::Sub(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedAccumulator *ptrWrappedAccumulator = ObjectWrap::Unwrap<WrappedAccumulator>(args.Holder());
+	rational<long> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toRational(isolate, args[0], r)) return;
+	ptrWrappedAccumulator->accumulator -= r;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedAccumulator::Mul(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedAccumulator *ptrWrappedAccumulator = ObjectWrap::Unwrap<WrappedAccumulator>(args.Holder());
+	rational<long> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toRational(isolate, args[0], r)) return;
+	ptrWrappedAccumulator->accumulator *= r;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedAccumulator::Div(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedAccumulator *ptrWrappedAccumulator = ObjectWrap::Unwrap<WrappedAccumulator>(args.Holder());
+	rational<long> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toRational(isolate, args[0], r)) return;
+
+	if(!r){
+		throwException(isolate, Exception::TypeError, "Rational: division by zero");
+		return;
+	}
+
+	ptrWrappedAccumulator->accumulator /= r;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedAccumulator::GetValue(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedAccumulator *ptrWrappedAccumulator = ObjectWrap::Unwrap<WrappedAccumulator>(args.Holder());
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	args.GetReturnValue().Set(WrappedRational::NewInstance(isolate, AddonData::From(args), ptrWrappedAccumulator->accumulator.value()));
+}
+
+void addon::WrappedAccumulator::Reset(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedAccumulator *ptrWrappedAccumulator = ObjectWrap::Unwrap<WrappedAccumulator>(args.Holder());
+	rational<long> r;
+
+	switch(args.Length()){
+		case 0:
+		break;
+
+		case 1:
+			if(!toRational(isolate, args[0], r)) return;
+		break;
+
+		default:
+			throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+			return;
+	}
+
+	ptrWrappedAccumulator->accumulator.reset(r);
+
+	args.GetReturnValue().Set(args.This());
+}
@@ -0,0 +1,61 @@
+/**
+ * @file    accumulator-addon.h
+ * @version v1.0.0
+ * @author  Essam A. El-Sherif
+ */
+
+#ifndef __ACCUMULATOR_ADDON_H__
+#define __ACCUMULATOR_ADDON_H__
+
+#include <node.h>
+#include <node_object_wrap.h>
+
+#include "../include/rational_accumulator.h"
+#include "rational-addon.h"
+
+/**
+ * namespace addon
+ */
+namespace addon{
+
+	using src::rational_accumulator;
+
+	/**
+	 * A class that extends the base class ObjectWrap provided by Node.js and
+	 * can be instantiated from JavaScript using the new operator, accumulating
+	 * sums and products of rationals that are normalized only when read.
+	 */
+	class WrappedAccumulator : public node::ObjectWrap{
+		public:
+			/**
+			 * A static function responsible for adding all class functions
+			 * calleable from JavaScript code to the exports object.
+			 */
+			static void Init(Local<Object>, AddonData*);
+		private:
+			rational_accumulator<long> accumulator;
+
+			/** Default constructor */
+			explicit WrappedAccumulator(){}
+
+			/** One argument constructor */
+			explicit WrappedAccumulator(const rational<long>& r)
+				: accumulator(r){}
+
+			/**
+			 * A static function associated with the JavaScript function 'Accumulator'
+			 * which should be called within the context of 'new Accumulator(...)'.
+			 */
+			static void New(const FunctionCallbackInfo<Value>&);
+
+			static void Add(const FunctionCallbackInfo<Value>&);
+			static void Sub(const FunctionCallbackInfo<Value>&);
+			static void Mul(const FunctionCallbackInfo<Value>&);
+			static void Div(const FunctionCallbackInfo<Value>&);
+
+			static void GetValue(const FunctionCallbackInfo<Value>&);
+			static void Reset(const FunctionCallbackInfo<Value>&);
+	};
+}
+
+#endif
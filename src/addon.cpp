@@ -5,19 +5,57 @@
  */
 
 #include "rational-addon.h"
+#include "accumulator-addon.h"
+#include "bigrational-addon.h"
 
-void addon::Init(Local<Object> exports, Local<Value>, void*){
-	WrappedRational::Init(exports);
+void addon::Init(Local<Object> exports, Local<Value>, Local<v8::Context> context, void*){
+	Isolate *isolate = context->GetIsolate();
+
+	/* A fresh state for every environment loading the addon, deleted with it. */
+	AddonData *data = new AddonData();
+	data->hook = node::AddEnvironmentCleanupHook(isolate, AddonData::Cleanup, data);
+
+	WrappedRational::Init(exports, data);
+	WrappedAccumulator::Init(exports, data);
+	WrappedBigRational::Init(exports, data);
+}
+
+void addon::AddonData::Cleanup(void *arg, void (*done)(void*), void *doneArg){
+	AddonData *data = static_cast<AddonData*>(arg);
+
+	data->rationalConstructor.Reset();
+	data->rationalTemplate.Reset();
+	data->accumulatorConstructor.Reset();
+	data->bigRationalConstructor.Reset();
+	data->bigRationalTemplate.Reset();
+	data->constants.clear();
+	data->cache.clear();
+
+	data->closing = true;
+	data->done = done;
+	data->doneArg = doneArg;
+
+	/* Otherwise the last pending job releases the state when done. */
+	if(!data->pending) data->Release();
+}
+
+void addon::AddonData::Release(){
+	void (*cb)(void*) = done;
+	void *cbArg = doneArg;
+
+	delete this;
+	cb(cbArg);
 }
 
 /*
  * C++ macro defined by 'node.h'
  *
  * This macro creates code that will (when loaded by Node.js)
- * register a module named 'rational' within the JavaScript
- * context (V8) ... bindings.gyp => targets.target_name
+ * register a context-aware module named 'rational' within the
+ * JavaScript context (V8) ... bindings.gyp => targets.target_name
  *
- * In addition, it will ensure that a function called 'addon::Init'
- * is called when the module is required.
+ * Unlike NODE_MODULE, it ensures that a function called 'addon::Init'
+ * is called in every environment requiring the module, the main
+ * thread and each worker thread.
  */
-NODE_MODULE(rational, addon::Init)
+NODE_MODULE_CONTEXT_AWARE(rational, addon::Init)
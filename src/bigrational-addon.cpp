@@ -0,0 +1,818 @@
+/**
+ * @file    bigrational-addon.cpp
+ * @version v1.0.0
+ * @author  Essam A. El-Sherif
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bigrational-addon.h"
+
+namespace addon{
+
+	using v8::Boolean;
+	using v8::Context;
+	using v8::NewStringType;
+	using v8::Number;
+	using v8::ObjectTemplate;
+
+	const int WrappedBigRational::brand = 0;
+
+	/**
+	 * The largest number of bits of the terms of a power, well below the 2^30 bits of the largest
+	 * BigInt V8 creates, so that a single call by quadratic multiplication stays within tens of
+	 * milliseconds instead of blocking the event loop for minutes.
+	 */
+	static const double maxPowerBits = 1 << 18;
+
+	/** Base 2 logarithm of the magnitude of the given integer, -inf for zero. */
+	static double magnitudeLog2(const bigint& n){
+		const std::size_t bits = n.bit_length();
+
+		/* Beyond the range of doubles, the bit length is close enough. */
+		if(bits > 1000) return static_cast<double>(bits);
+
+		return std::log2(std::fabs(static_cast<double>(n)));
+	}
+
+	/** The power of two of the given exponent. */
+	static bigint powerOfTwo(std::size_t e){
+		std::vector<std::uint64_t> words(e / 64 + 1);
+		words.back() = std::uint64_t(1) << (e % 64);
+
+		return bigint::from_words(false, words.data(), words.size());
+	}
+
+	/**
+	 * The nearest double to the given rational, whatever the size of its terms. The magnitude is
+	 * divided to a quotient of 62 or 63 bits and a remainder, rounded once to nearest with ties to
+	 * even, keeping fewer bits for subnormal results.
+	 */
+	static double toDouble(const rational<bigint>& r){
+		typedef std::uint64_t U;
+
+		if(!r) return 0.0;
+
+		const bool negative = r.numerator().sign() < 0;
+		const bigint n = negative ? -r.numerator() : r.numerator();
+		const bigint& d = r.denominator();
+
+		/* The quotient lies in [2^(diff - 1), 2^(diff + 1)). */
+		const long diff = static_cast<long>(n.bit_length()) - static_cast<long>(d.bit_length());
+
+		if(diff > 1025)  return negative ? -HUGE_VAL : HUGE_VAL;
+		if(diff < -1076) return negative ? -0.0 : 0.0;
+
+		/* n/d = (q + rem/b)·2^-shift, with 2^61 <= q < 2^63. */
+		const long shift = 62 - diff;
+
+		const bigint a = shift > 0 ? n * powerOfTwo(shift) : n;
+		const bigint b = shift < 0 ? d * powerOfTwo(-shift) : d;
+
+		const bigint q = a / b, rem = a % b;
+
+		U m = q.to_words()[0];
+
+		int bits = 0;
+		for(U t = m; t; t >>= 1) bits++;
+
+		/* The exponent of the leading bit, below -1022 losing a bit of precision per step. */
+		const long top = bits - 1 - shift;
+
+		if(top > 1023)  return negative ? -HUGE_VAL : HUGE_VAL;
+		if(top < -1075) return negative ? -0.0 : 0.0;
+
+		const int keep = top < -1022 ? static_cast<int>(top + 1075) : std::numeric_limits<double>::digits;
+		const int drop = bits - keep;
+
+		const U low = m & ((U(1) << drop) - 1), half = U(1) << (drop - 1);
+		m >>= drop;
+
+		if(low > half || (low == half && (rem || (m & 1)))) m++;
+
+		const double x = std::ldexp(static_cast<double>(m), static_cast<int>(drop - shift));
+		return negative ? -x : x;
+	}
+
+	/**
+	 * Checks the given power of the given rational for terms of at most maxPowerBits bits,
+	 * throwing a JavaScript exception and returning false otherwise.
+	 */
+	static bool checkPower(Isolate *isolate, const rational<bigint>& r, long n){
+		if(n < 0 && !r){
+			throwException(isolate, Exception::TypeError, "Rational: division by zero");
+			return false;
+		}
+
+		const double bits = std::max(magnitudeLog2(r.numerator()), magnitudeLog2(r.denominator()));
+
+		if(bits > 0 && std::fabs(static_cast<double>(n)) * bits > maxPowerBits){
+			throwException(isolate, Exception::RangeError, "Rational: arithmetic overflow");
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Converts an integer exponent, throwing a JavaScript exception and returning false
+	 * if it is a fractional number or otherwise not an integer in range.
+	 */
+	static bool toExponent(Isolate *isolate, Local<Value> arg, long& n){
+		if(arg->IsNumber()){
+			const double value = arg.As<Number>()->Value();
+
+			if(std::isfinite(value) && value != std::trunc(value)){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+		}
+
+		return toInteger(isolate, arg, n);
+	}
+
+	bool toInteger(Isolate *isolate, Local<Value> arg, bigint& n){
+
+		if(arg->IsBigInt()){
+			Local<BigInt> big = arg.As<BigInt>();
+
+			/* The magnitude, as the least significant 64-bit word first. */
+			int count = big->WordCount();
+			int sign = 0;
+			std::vector<uint64_t> words(count);
+
+			big->ToWordsArray(&sign, &count, words.data());
+
+			n = bigint::from_words(sign != 0, words.data(), static_cast<std::size_t>(count));
+		}
+		else
+		if(arg->IsNumber()){
+
+			const double value = arg.As<Number>()->Value();
+			if(!std::isfinite(value) || value != std::trunc(value)){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+
+			/* Beyond 2^63, an integer of 53 significant bits scaled by a power of two. */
+			int e;
+			const double m = std::ldexp(std::frexp(value, &e), 53);
+
+			if(e <= 63){
+				n = bigint(static_cast<long long>(value));
+			}
+			else{
+				n = bigint(static_cast<long long>(m));
+				for(e -= 53; e >= 32; e -= 32)
+					n *= bigint(1ULL << 32);
+				n *= bigint(1ULL << e);
+			}
+		}
+		else{
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool toExact(Isolate *isolate, Local<Value> arg, rational<bigint>& r){
+
+		if(arg->IsNumber()){
+
+			const double value = arg.As<Number>()->Value();
+
+			/* A fraction m·2^(e-53), of an integer m of 53 bits at most, held exactly. */
+			if(std::isfinite(value) && value != std::trunc(value)){
+				int e;
+				const double m = std::ldexp(std::frexp(value, &e), 53);
+
+				r = rational<bigint>(bigint(static_cast<long long>(m))) * src::pow(rational<bigint>(bigint(2)), e - 53);
+				return true;
+			}
+		}
+
+		bigint n;
+		if(!toInteger(isolate, arg, n)) return false;
+
+		r = rational<bigint>(n);
+		return true;
+	}
+
+	MaybeLocal<BigInt> toBigInt(Isolate *isolate, const bigint& n){
+		const std::vector<uint64_t> words = n.to_words();
+
+		return BigInt::NewFromWords(isolate->GetCurrentContext(), n.sign() < 0, static_cast<int>(words.size()), words.data());
+	}
+
+	bool toBigRational(Isolate *isolate, Local<Value> arg, rational<bigint>& r){
+
+		if(arg->IsObject()){
+
+			if(const WrappedBigRational *ptrOther = WrappedBigRational::FromValue(isolate, arg)){
+				r = ptrOther->value;
+				return true;
+			}
+
+			if(const WrappedRational *ptrOther = WrappedRational::FromValue(isolate, arg)){
+				r = rational<bigint>(ptrOther->value);
+				return true;
+			}
+
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return false;
+		}
+		else
+		if(arg->IsNumber() || arg->IsBigInt()){
+
+			if(!toExact(isolate, arg, r)) return false;
+		}
+		else
+		if(arg->IsString()){
+
+			String::Utf8Value str(isolate, arg);
+
+			/* The "n/d" form given by toString(), or an integer. */
+			const std::string s(*str, str.length());
+			const std::size_t solidus = s.find('/');
+
+			bigint n, d(1);
+
+			try{
+				n = bigint(s.substr(0, solidus));
+
+				if(solidus != std::string::npos)
+					d = bigint(s.substr(solidus + 1));
+			}
+			catch(std::invalid_argument&){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+
+			if(!d){
+				throwException(isolate, Exception::TypeError, "Rational: bad rational, zero denominator");
+				return false;
+			}
+
+			r = rational<bigint>(n, d);
+		}
+		else{
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return false;
+		}
+
+		return true;
+	}
+}
+
+void addon::WrappedBigRational::Init(Local<Object> exports, AddonData *addonData){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = exports->GetIsolate();
+
+	/* Context of the currently running JavaScript instance. */
+	Local<Context> context = isolate->GetCurrentContext();
+
+	const char* className = "BigRational";
+
+	/* The state of this environment, passed to every callback. */
+	Local<External> data = External::New(isolate, addonData);
+
+	Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, guarded<WrappedBigRational::New>, data);
+
+	tpl->SetClassName(
+		String::NewFromUtf8(isolate, className).ToLocalChecked()
+	);
+
+	/* The wrapped object, followed by its brand. */
+	Local<ObjectTemplate> otpl = tpl->InstanceTemplate();
+	otpl->SetInternalFieldCount(2);
+
+	setPrototypeMethod(tpl, "getNumerator",   guarded<GetNumerator>,   data);
+	setPrototypeMethod(tpl, "getDenominator", guarded<GetDenominator>, data);
+
+	setPrototypeMethod(tpl, "assign", guarded<Assign>, data);
+
+	setPrototypeMethod(tpl, "selfAdd", guarded<SelfAdd>, data);
+	setPrototypeMethod(tpl, "selfSub", guarded<SelfSub>, data);
+	setPrototypeMethod(tpl, "selfMul", guarded<SelfMul>, data);
+	setPrototypeMethod(tpl, "selfDiv", guarded<SelfDiv>, data);
+	setPrototypeMethod(tpl, "selfPow", guarded<SelfPow>, data);
+
+	setPrototypeMethod(tpl, "add", guarded<Add>, data);
+	setPrototypeMethod(tpl, "sub", guarded<Sub>, data);
+	setPrototypeMethod(tpl, "mul", guarded<Mul>, data);
+	setPrototypeMethod(tpl, "div", guarded<Div>, data);
+	setPrototypeMethod(tpl, "pow", guarded<Pow>, data);
+
+	setPrototypeMethod(tpl, "neg", guarded<Neg>, data);
+	setPrototypeMethod(tpl, "abs", guarded<Abs>, data);
+
+	setPrototypeMethod(tpl, "lessThan",    guarded<LessThan>,    data);
+	setPrototypeMethod(tpl, "greaterThan", guarded<GreaterThan>, data);
+	setPrototypeMethod(tpl, "equalTo",     guarded<EqualTo>,     data);
+	setPrototypeMethod(tpl, "notEqualTo",  guarded<NotEqualTo>,  data);
+
+	setPrototypeMethod(tpl, "valueOf",  guarded<ValueOf>,  data);
+	setPrototypeMethod(tpl, "toString", guarded<ToString>, data);
+
+	addonData->bigRationalConstructor.Reset(isolate, tpl->GetFunction(context).ToLocalChecked());
+	addonData->bigRationalTemplate.Reset(isolate, tpl);
+
+	exports->Set(
+		context,
+		String::NewFromUtf8(isolate, className).ToLocalChecked(),
+		tpl->GetFunction(context).ToLocalChecked()
+	).Check();
+}
+
+addon::WrappedBigRational* addon::WrappedBigRational::FromValue(Isolate*, Local<Value> arg){
+	if(!arg->IsObject())
+		return nullptr;
+
+	Local<Object> object = arg.As<Object>();
+
+	if(object->InternalFieldCount() != 2 || object->GetAlignedPointerFromInternalField(1) != &brand)
+		return nullptr;
+
+	return ObjectWrap::Unwrap<WrappedBigRational>(object);
+}
+
+v8::Local<v8::Object> addon::WrappedBigRational::NewInstance(Isolate *isolate, const AddonData *addonData, const rational<bigint>& r){
+	Local<Object> object = Local<FunctionTemplate>::New(isolate, addonData->bigRationalTemplate)->InstanceTemplate()
+		->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
+
+	(new WrappedBigRational(r))->Attach(isolate, object);
+	return object;
+}
+
+void addon::WrappedBigRational::New(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	/* Context of the currently running JavaScript instance. */
+	Local<Context> context = isolate->GetCurrentContext();
+
+	// Invoked as plain function `BigRational(...)`, turn into construct call.
+	if(!args.IsConstructCall()){
+		Local<Function> cons = Local<Function>::New(isolate, AddonData::From(args)->bigRationalConstructor);
+
+		/* An exception thrown by the constructor stays pending for the caller. */
+		Local<Object> instance;
+
+		switch(args.Length()){
+			case 0:
+				if(cons->NewInstance(context, 0, nullptr).ToLocal(&instance))
+					args.GetReturnValue().Set(instance);
+			break;
+			case 1: {
+				Local<Value> argv[] = { args[0] };
+				if(cons->NewInstance(context, 1, argv).ToLocal(&instance))
+					args.GetReturnValue().Set(instance);
+			}
+			break;
+			case 2: {
+				Local<Value> argv[] = { args[0], args[1] };
+				if(cons->NewInstance(context, 2, argv).ToLocal(&instance))
+					args.GetReturnValue().Set(instance);
+			}
+			break;
+			default:
+				throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		}
+		return;
+	}
+
+	rational<bigint> r;
+
+	switch(args.Length()){
+		case 0:
+		break;
+
+		case 1:
+			if(!toBigRational(isolate, args[0], r)) return;
+		break;
+
+		case 2: {
+			rational<bigint> n, d;
+			if(!toExact(isolate, args[0], n) || !toExact(isolate, args[1], d)) return;
+
+			if(!d){
+				throwException(isolate, Exception::TypeError, "Rational: bad rational, zero denominator");
+				return;
+			}
+
+			r = n / d;
+		}
+		break;
+
+		default:
+			throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+			return;
+	}
+
+	(new WrappedBigRational(r))->Attach(isolate, args.This());
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedBigRational::GetNumerator(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+
+	Local<BigInt> retval;
+	if(!toBigInt(isolate, ptrWrappedBigRational->value.numerator()).ToLocal(&retval)) return;
+
+	args.GetReturnValue().Set(retval);
+}
+
+void addon::WrappedBigRational::GetDenominator(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+
+	Local<BigInt> retval;
+	if(!toBigInt(isolate, ptrWrappedBigRational->value.denominator()).ToLocal(&retval)) return;
+
+	args.GetReturnValue().Set(retval);
+}
+
+void addon::WrappedBigRational::Assign(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	switch(args.Length()){
+		case 1:
+			if(!toBigRational(isolate, args[0], r)) return;
+		break;
+
+		case 2: {
+			rational<bigint> n, d;
+			if(!toExact(isolate, args[0], n) || !toExact(isolate, args[1], d)) return;
+
+			if(!d){
+				throwException(isolate, Exception::TypeError, "Rational: bad rational, zero denominator");
+				return;
+			}
+
+			r = n / d;
+		}
+		break;
+
+		default:
+			throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+			return;
+	}
+
+	ptrWrappedBigRational->value = r;
+}
+
+void addon::WrappedBigRational::SelfAdd(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+	ptrWrappedBigRational->value += r;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedBigRational::SelfSub(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+	ptrWrappedBigRational->value -= r;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedBigRational::SelfMul(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+	ptrWrappedBigRational->value *= r;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedBigRational::SelfDiv(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	if(!r){
+		throwException(isolate, Exception::TypeError, "Rational: division by zero");
+		return;
+	}
+
+	ptrWrappedBigRational->value /= r;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedBigRational::SelfPow(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	long n;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toExponent(isolate, args[0], n)) return;
+
+	if(!checkPower(isolate, ptrWrappedBigRational->value, n)) return;
+
+	ptrWrappedBigRational->value = src::pow(ptrWrappedBigRational->value, n);
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedBigRational::Add(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), ptrWrappedBigRational->value + r));
+}
+
+void addon::WrappedBigRational::Sub(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), ptrWrappedBigRational->value - r));
+}
+
+void addon::WrappedBigRational::Mul(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), ptrWrappedBigRational->value * r));
+}
+
+void addon::WrappedBigRational::Div(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	if(!r){
+		throwException(isolate, Exception::TypeError, "Rational: division by zero");
+		return;
+	}
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), ptrWrappedBigRational->value / r));
+}
+
+void addon::WrappedBigRational::Pow(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	long n;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toExponent(isolate, args[0], n)) return;
+
+	if(!checkPower(isolate, ptrWrappedBigRational->value, n)) return;
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), src::pow(ptrWrappedBigRational->value, n)));
+}
+
+void addon::WrappedBigRational::Neg(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), -ptrWrappedBigRational->value));
+}
+
+void addon::WrappedBigRational::Abs(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), src::abs(ptrWrappedBigRational->value)));
+}
+
+void addon::WrappedBigRational::LessThan(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	args.GetReturnValue().Set(Boolean::New(isolate, ptrWrappedBigRational->value < r));
+}
+
+void addon::WrappedBigRational::GreaterThan(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	args.GetReturnValue().Set(Boolean::New(isolate, ptrWrappedBigRational->value > r));
+}
+
+void addon::WrappedBigRational::EqualTo(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	args.GetReturnValue().Set(Boolean::New(isolate, ptrWrappedBigRational->value == r));
+}
+
+void addon::WrappedBigRational::NotEqualTo(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+	rational<bigint> r;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toBigRational(isolate, args[0], r)) return;
+
+	args.GetReturnValue().Set(Boolean::New(isolate, ptrWrappedBigRational->value != r));
+}
+
+void addon::WrappedBigRational::ValueOf(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	args.GetReturnValue().Set(Number::New(isolate, toDouble(ptrWrappedBigRational->value)));
+}
+
+void addon::WrappedBigRational::ToString(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedBigRational *ptrWrappedBigRational = ObjectWrap::Unwrap<WrappedBigRational>(args.Holder());
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	const std::string str = ptrWrappedBigRational->value.numerator().to_string() + "/" + ptrWrappedBigRational->value.denominator().to_string();
+
+	Local<String> retval = String::NewFromUtf8(isolate, str.data(), NewStringType::kNormal, static_cast<int>(str.size())).ToLocalChecked();
+
+	args.GetReturnValue().Set(retval);
+}
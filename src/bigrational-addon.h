@@ -0,0 +1,138 @@
+/**
+ * @file    bigrational-addon.h
+ * @version v1.0.0
+ * @author  Essam A. El-Sherif
+ */
+
+#ifndef __BIGRATIONAL_ADDON_H__
+#define __BIGRATIONAL_ADDON_H__
+
+#include <node.h>
+#include <node_object_wrap.h>
+
+#include "../include/bigint.h"
+#include "rational-addon.h"
+
+/**
+ * namespace addon
+ */
+namespace addon{
+
+	using v8::BigInt;
+	using v8::MaybeLocal;
+
+	using src::bigint;
+
+	/**
+	 * Converts a JavaScript integral number or BigInt into an arbitrary precision integer,
+	 * throwing a JavaScript exception and returning false if it is neither.
+	 */
+	bool toInteger(Isolate*, Local<Value>, bigint&);
+
+	/**
+	 * Converts a JavaScript number, taken as the exact value of the double, or BigInt into an
+	 * arbitrary precision rational, throwing a JavaScript exception and returning false if it
+	 * is neither.
+	 */
+	bool toExact(Isolate*, Local<Value>, rational<bigint>&);
+
+	/**
+	 * Converts an arbitrary precision integer into a JavaScript BigInt, empty with a
+	 * pending JavaScript exception if it exceeds the largest BigInt V8 can create.
+	 */
+	MaybeLocal<BigInt> toBigInt(Isolate*, const bigint&);
+
+	/**
+	 * Converts a JavaScript BigRational, Rational, number, BigInt or numeric string into an
+	 * arbitrary precision rational, throwing a JavaScript exception and returning false if it
+	 * is none of them.
+	 */
+	bool toBigRational(Isolate*, Local<Value>, rational<bigint>&);
+
+	/**
+	 * A class that extends the base class ObjectWrap provided by Node.js and
+	 * can be instantiated from JavaScript using the new operator, holding an
+	 * arbitrary precision rational exchanged with JavaScript as BigInt values.
+	 */
+	class WrappedBigRational : public node::ObjectWrap{
+		public:
+			/**
+			 * A static function responsible for adding all class functions
+			 * calleable from JavaScript code to the exports object.
+			 */
+			static void Init(Local<Object>, AddonData*);
+
+			/**
+			 * Returns the wrapped object of a JavaScript BigRational, or nullptr if the value
+			 * is not an object constructed by a 'BigRational' function of any environment.
+			 */
+			static WrappedBigRational* FromValue(Isolate*, Local<Value>);
+
+			/**
+			 * Returns a new JavaScript BigRational wrapping the given normalized value,
+			 * instantiated from the object template without calling 'New'.
+			 */
+			static Local<Object> NewInstance(Isolate*, const AddonData*, const rational<bigint>&);
+		private:
+			friend bool toBigRational(Isolate*, Local<Value>, rational<bigint>&);
+
+			/** The value, its terms allocating once they do not fit in a long long. */
+			rational<bigint> value;
+
+			/** Copy of a normalized value */
+			explicit WrappedBigRational(const rational<bigint>& r)
+				: value(r){}
+
+			/** Releases the native size reported to V8 by Attach, unless the isolate is being torn down. */
+			~WrappedBigRational(){
+				if(Isolate *isolate = Isolate::GetCurrent())
+					isolate->AdjustAmountOfExternalAllocatedMemory(-static_cast<int64_t>(sizeof(WrappedBigRational)));
+			}
+
+			/** Wraps and brands the given object, reporting the native size to V8 as external memory. */
+			void Attach(Isolate *isolate, Local<Object> object){
+				Wrap(object);
+				object->SetAlignedPointerInInternalField(1, const_cast<int*>(&brand));
+				isolate->AdjustAmountOfExternalAllocatedMemory(sizeof(WrappedBigRational));
+			}
+
+			/** The address stored in the second internal field of every BigRational object. */
+			static const int brand;
+
+			/**
+			 * A static function associated with the JavaScript function 'BigRational'
+			 * which should be called within the context of 'new BigRational(...)'.
+			 */
+			static void New(const FunctionCallbackInfo<Value>&);
+
+			static void GetNumerator(const FunctionCallbackInfo<Value>&);
+			static void GetDenominator(const FunctionCallbackInfo<Value>&);
+
+			static void Assign(const FunctionCallbackInfo<Value>&);
+
+			static void SelfAdd(const FunctionCallbackInfo<Value>&);
+			static void SelfSub(const FunctionCallbackInfo<Value>&);
+			static void SelfMul(const FunctionCallbackInfo<Value>&);
+			static void SelfDiv(const FunctionCallbackInfo<Value>&);
+			static void SelfPow(const FunctionCallbackInfo<Value>&);
+
+			static void Add(const FunctionCallbackInfo<Value>&);
+			static void Sub(const FunctionCallbackInfo<Value>&);
+			static void Mul(const FunctionCallbackInfo<Value>&);
+			static void Div(const FunctionCallbackInfo<Value>&);
+			static void Pow(const FunctionCallbackInfo<Value>&);
+
+			static void Neg(const FunctionCallbackInfo<Value>&);
+			static void Abs(const FunctionCallbackInfo<Value>&);
+
+			static void LessThan(const FunctionCallbackInfo<Value>&);
+			static void GreaterThan(const FunctionCallbackInfo<Value>&);
+			static void EqualTo(const FunctionCallbackInfo<Value>&);
+			static void NotEqualTo(const FunctionCallbackInfo<Value>&);
+
+			static void ValueOf(const FunctionCallbackInfo<Value>&);
+			static void ToString(const FunctionCallbackInfo<Value>&);
+	};
+}
+
+#endif
@@ -10,34 +10,326 @@
 #include <cstdlib>
 #include <cmath>
 
+#include "../include/bigint.h"
 #include "rational-addon.h"
 
 namespace addon{
 
-	using v8::Isolate;
 	using v8::Context;
-	using v8::FunctionTemplate;
 	using v8::ObjectTemplate;
-	using v8::Exception;
 	using v8::Number;
 	using v8::Boolean;
+	using v8::BigInt;
 	using v8::DEFAULT;
 	using v8::DontEnum;
+	using v8::DontDelete;
+	using v8::PropertyAttribute;
+	using v8::ReadOnly;
 	using v8::MaybeLocal;
+	using v8::NewStringType;
 
-	Persistent<Function> WrappedRational::constructor;
+	const int WrappedRational::brand = 0;
+
+#ifdef RATIONAL_FAST_API
+	/** The fast API overload of the given function, living as long as the templates using it. */
+	template<auto F>
+	const v8::CFunction* fastCall(){
+		static const v8::CFunction c = v8::CFunction::Make(F);
+		return &c;
+	}
+
+	#define RATIONAL_FAST_CALL(f) fastCall<f>()
+#else
+	#define RATIONAL_FAST_CALL(f) nullptr
+#endif
+
+	void setPrototypeMethod(Local<FunctionTemplate> recv, const char* name, v8::FunctionCallback callback, Local<Value> data, const v8::CFunction* fast){
+		Isolate *isolate = Isolate::GetCurrent();
+		v8::HandleScope scope(isolate);
+
+		Local<FunctionTemplate> t = FunctionTemplate::New(
+			isolate, callback, data, v8::Signature::New(isolate, recv), 0,
+			v8::ConstructorBehavior::kAllow, v8::SideEffectType::kHasSideEffect, fast);
+
+		Local<String> fn_name = String::NewFromUtf8(isolate, name, NewStringType::kInternalized).ToLocalChecked();
+
+		t->SetClassName(fn_name);
+		recv->PrototypeTemplate()->Set(fn_name, t);
+	}
+
+	bool isInteger(double value){
+		return value == std::trunc(value) && std::fabs(value) < 9223372036854775808.0;
+	}
+
+	bool toInteger(Isolate *isolate, Local<Value> arg, long& n){
+
+		if(arg->IsBigInt()){
+
+			bool lossless;
+			n = arg.As<BigInt>()->Int64Value(&lossless);
+
+			if(!lossless){
+				throwException(isolate, Exception::RangeError, "Rational: arithmetic overflow");
+				return false;
+			}
+		}
+		else
+		if(arg->IsNumber()){
+
+			double value = arg.As<Number>()->Value();
+			if(std::isnan(value)){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+
+			if(!(std::fabs(value) < 9223372036854775808.0)){
+				throwException(isolate, Exception::RangeError, "Rational: arithmetic overflow");
+				return false;
+			}
+
+			n = value;
+		}
+		else{
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool toIntegral(Isolate *isolate, Local<Value> arg, long& n){
+		if(arg->IsNumber()){
+			const double value = arg.As<Number>()->Value();
+
+			if(std::isfinite(value) && value != std::trunc(value)){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+		}
+
+		return toInteger(isolate, arg, n);
+	}
+
+	bool toExact(Isolate *isolate, Local<Value> arg, rational<long>& r){
+
+		if(arg->IsNumber()){
+
+			double value = arg.As<Number>()->Value();
+			if(std::isnan(value)){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+
+			try{
+				r = src::from_double<long>(value);
+			}
+			catch(const src::rational_overflow&){
+				throwException(isolate, Exception::RangeError, "Rational: arithmetic overflow");
+				return false;
+			}
+
+			return true;
+		}
+
+		long n;
+		if(!toInteger(isolate, arg, n)) return false;
+
+		r = rational<long>(n);
+		return true;
+	}
+
+	rational<long> parseRational(const char *first, const char *last){
+		rational<long> r;
+
+		const std::from_chars_result res = src::from_chars(first, last, r);
+
+		if(res.ec == std::errc::result_out_of_range)
+			throw src::rational_overflow();
+
+		/* A zero denominator, unlike a missing numerator, leaves the end of the match in ptr. */
+		if(res.ec == std::errc::invalid_argument && res.ptr != first)
+			throw src::bad_rational();
+
+		if(res.ec != std::errc() || res.ptr != last)
+			throw std::invalid_argument("parse: not a rational");
+
+		return r;
+	}
+
+	bool toParsed(Isolate *isolate, Local<Value> arg, rational<long>& r){
+		String::Utf8Value str(isolate, arg);
+
+		try{
+			r = parseRational(*str, *str + str.length());
+		}
+		catch(const src::rational_overflow&){
+			throwException(isolate, Exception::RangeError, "Rational: arithmetic overflow");
+			return false;
+		}
+		catch(const src::bad_rational& e){
+			throwException(isolate, Exception::TypeError, badRationalMessage(e).c_str());
+			return false;
+		}
+		catch(const std::invalid_argument&){
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool toTerm(Isolate *isolate, Local<Value> arg, rational<long>& r){
+		if(arg->IsString()) return toParsed(isolate, arg, r);
+
+		return toExact(isolate, arg, r);
+	}
+
+	bool isTerm(Local<Value> arg){
+		return arg->IsNumber() || arg->IsBigInt() || arg->IsString();
+	}
+
+	bool toRational(Isolate *isolate, Local<Value> arg, rational<long>& r){
+
+		if(arg->IsObject()){
+
+			const WrappedRational *ptrOther = WrappedRational::FromValue(isolate, arg);
+
+			if(!ptrOther){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+
+			r = ptrOther->value;
+		}
+		else
+		if(arg->IsNumber() || arg->IsBigInt()){
+
+			if(!toExact(isolate, arg, r)) return false;
+		}
+		else
+		if(arg->IsString()){
+
+			if(!toParsed(isolate, arg, r)) return false;
+		}
+		else{
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * The frozen constants of the 'Rational' function, by name.
+	 */
+	const struct{ const char *name; long num, den; } constants[] = {
+		{ "ZERO", 0, 1 }, { "ONE", 1, 1 }, { "TWO", 2, 1 }, { "MINUS_ONE", -1, 1 }, { "HALF", 1, 2 }
+	};
+
+	/** The largest bound of the small-rational cache. */
+	const long maxCacheBound = 64;
+
+	/**
+	 * Converts the bound of the denominator of an approximation, throwing a JavaScript
+	 * exception and returning false if it is not an integer of at least 1.
+	 */
+	bool toBound(Isolate *isolate, Local<Value> arg, long& bound){
+		if(!toInteger(isolate, arg, bound)) return false;
+
+		if(bound < 1){
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * The closest rational to a double with a denominator up to the bound. A double below 2^-10,
+	 * whose exact denominator may exceed a long, is taken through a rational of bigint.
+	 */
+	rational<long> approximate(double x, long bound){
+		if(!(std::fabs(x) < std::ldexp(1.0, -10)) || x == 0.0)
+			return src::limit_denominator(src::from_double<long>(x), bound);
+
+		int e;
+		long long m = static_cast<long long>(std::ldexp(std::frexp(x, &e), std::numeric_limits<double>::digits));
+		e -= std::numeric_limits<double>::digits;
+
+		src::bigint den(1);
+		for( ; e <= -32; e += 32) den *= src::bigint(1ULL << 32);
+		den *= src::bigint(1ULL << -e);
+
+		const rational<src::bigint> r = src::limit_denominator(rational<src::bigint>(src::bigint(m), den), src::bigint(bound));
+
+		return rational<long>(static_cast<long>(r.numerator()), static_cast<long>(r.denominator()));
+	}
+
+	/**
+	 * The rounding modes by name, those of Intl.NumberFormat.
+	 */
+	const struct{ const char *name; src::rounding mode; } roundingModes[] = {
+		{ "floor", src::rounding::floor }, { "ceil", src::rounding::ceil },
+		{ "trunc", src::rounding::trunc }, { "expand", src::rounding::expand },
+		{ "halfFloor", src::rounding::half_floor }, { "halfCeil", src::rounding::half_ceil },
+		{ "halfTrunc", src::rounding::half_trunc }, { "halfExpand", src::rounding::half_expand },
+		{ "halfEven", src::rounding::half_even }
+	};
+
+	/** The largest number of fraction digits of toFixed(), as that of Number.prototype.toFixed(). */
+	const int maxFixedDigits = 100;
+
+	/** The default and the largest number of fraction digits of toDecimalString(). */
+	const int defaultExpansionDigits = 100, maxExpansionDigits = 1000;
+
+	/**
+	 * Converts the name of a rounding mode, throwing a JavaScript exception and
+	 * returning false if it is none of them.
+	 */
+	bool toRounding(Isolate *isolate, Local<Value> arg, src::rounding& mode){
+		if(arg->IsString()){
+			String::Utf8Value str(isolate, arg);
+
+			for(const auto& m : roundingModes){
+				if(std::strcmp(*str, m.name) == 0){
+					mode = m.mode;
+					return true;
+				}
+			}
+		}
+
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return false;
+	}
 
 	/**
-	 * Throws an exception
+	 * Converts the operands of a static out-parameter form, the last of its given number of
+	 * arguments being the Rational object written into, returning that object or nullptr with
+	 * a pending JavaScript exception.
 	 */
-	inline void throwException(Isolate *isolate, Local<Value>(*func)(Local<String>), const char* msg){
-		isolate->ThrowException(
-			func(String::NewFromUtf8(isolate, msg).ToLocalChecked())
-		);
+	WrappedRational* toOperands(const FunctionCallbackInfo<Value>& args, int argc, rational<long> *operands){
+
+		/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+		Isolate *isolate = args.GetIsolate();
+
+		if(args.Length() != argc){
+			throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+			return nullptr;
+		}
+
+		for(int i = 0; i < argc - 1; i++)
+			if(!toRational(isolate, args[i], operands[i])) return nullptr;
+
+		if(!WrappedRational::FromValue(isolate, args[argc - 1])){
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return nullptr;
+		}
+
+		return WrappedRational::Mutable(isolate, args[argc - 1].As<Object>());
 	}
 }
 
-void addon::WrappedRational::Init(Local<Object> exports){
+void addon::WrappedRational::Init(Local<Object> exports, AddonData *addonData){
 
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = exports->GetIsolate();
@@ -47,12 +339,15 @@ void addon::WrappedRational::Init(Local<Object> exports){
 
 	const char* className = "Rational";
 
+	/* The state of this environment, passed to every callback. */
+	Local<External> data = External::New(isolate, addonData);
+
 	/*
 	 * Create a new JavaScript function using a FunctionTemplate.
 	 * This function is going to serve as a constructor function in JavaScript.
 	 * It will be initially invoked when JavaScript executes 'r = new Rational()'.
 	 */
-	Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, WrappedRational::New);
+	Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, guarded<WrappedRational::New>, data);
 
 	/* Set the class name of the v8::FunctionTemplate. */
 	tpl->SetClassName(
@@ -64,54 +359,126 @@ void addon::WrappedRational::Init(Local<Object> exports){
 
 	/*
 	 * To allow for a single instance of a C++ object (the WrappedRational)
-	 * to be associated with the ObjectTemplate.
+	 * to be associated with the ObjectTemplate, followed by its brand.
 	 */
-	otpl->SetInternalFieldCount(1);
+	otpl->SetInternalFieldCount(2);
 
 	/*
 	 * C++ inline function defined by 'node.h'
 	 *
 	 * Adds a function to the given v8::FunctionTemplate prototype,
 	 * and makes it callable from JavaScript by the name given.
+	 *
+	 * Every method is wrapped by 'guarded' so that an overflowing
+	 * operation throws a JavaScript RangeError instead of wrapping.
+	 *
+	 * The accessors, valueOf and the comparisons with a number have fast
+	 * API overloads when the V8 fast API is available, falling back to the
+	 * callbacks for a number that is not an integer in the range of long.
+	 * The chaining methods return 'this', which no fast call can.
 	 */
-	NODE_SET_PROTOTYPE_METHOD(tpl, "getNumerator",   GetNumerator);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "getDenominator", GetDenominator);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "assign",   Assign);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "selfAdd", SelfAdd);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "selfSub", SelfSub);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "selfMul", SelfMul);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "selfDiv", SelfDiv);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "selfPow", SelfPow);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "add", Add);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "sub", Sub);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "mul", Mul);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "div", Div);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "pow", Pow);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "preInc", PreInc);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "preDec", PreDec);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "postInc", PostInc);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "postDec", PostDec);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "selfNeg", SelfNeg);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "selfAbs", SelfAbs);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "neg", Neg);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "abs", Abs);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "not",  Not);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "bool", Bool);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "lessThan",    LessThan);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "greaterThan", GreaterThan);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "equalTo",     EqualTo);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "notEqualTo",  NotEqualTo);
-
-	NODE_SET_PROTOTYPE_METHOD(tpl, "valueOf", ValueOf);
-	NODE_SET_PROTOTYPE_METHOD(tpl, "toString", ToString);
+	setPrototypeMethod(tpl, "getNumerator",   guarded<GetNumerator>,   data, RATIONAL_FAST_CALL(FastGetNumerator));
+	setPrototypeMethod(tpl, "getDenominator", guarded<GetDenominator>, data, RATIONAL_FAST_CALL(FastGetDenominator));
+
+	setPrototypeMethod(tpl, "assign",   guarded<Assign>, data);
+
+	setPrototypeMethod(tpl, "selfAdd", guarded<SelfAdd>, data);
+	setPrototypeMethod(tpl, "selfSub", guarded<SelfSub>, data);
+	setPrototypeMethod(tpl, "selfMul", guarded<SelfMul>, data);
+	setPrototypeMethod(tpl, "selfDiv", guarded<SelfDiv>, data);
+	setPrototypeMethod(tpl, "selfPow", guarded<SelfPow>, data);
+
+	setPrototypeMethod(tpl, "add", guarded<Add>, data);
+	setPrototypeMethod(tpl, "sub", guarded<Sub>, data);
+	setPrototypeMethod(tpl, "mul", guarded<Mul>, data);
+	setPrototypeMethod(tpl, "div", guarded<Div>, data);
+	setPrototypeMethod(tpl, "pow", guarded<Pow>, data);
+
+	setPrototypeMethod(tpl, "preInc", guarded<PreInc>, data);
+	setPrototypeMethod(tpl, "preDec", guarded<PreDec>, data);
+	setPrototypeMethod(tpl, "postInc", guarded<PostInc>, data);
+	setPrototypeMethod(tpl, "postDec", guarded<PostDec>, data);
+
+	setPrototypeMethod(tpl, "selfNeg", guarded<SelfNeg>, data);
+	setPrototypeMethod(tpl, "selfAbs", guarded<SelfAbs>, data);
+
+	setPrototypeMethod(tpl, "neg", guarded<Neg>, data);
+	setPrototypeMethod(tpl, "abs", guarded<Abs>, data);
+
+	setPrototypeMethod(tpl, "limitDenominator", guarded<LimitDenominator>, data);
+
+	setPrototypeMethod(tpl, "floor", guarded<Floor>, data);
+	setPrototypeMethod(tpl, "ceil",  guarded<Ceil>,  data);
+	setPrototypeMethod(tpl, "round", guarded<Round>, data);
+
+	setPrototypeMethod(tpl, "not",  guarded<Not>, data);
+	setPrototypeMethod(tpl, "bool", guarded<Bool>, data);
+
+	setPrototypeMethod(tpl, "lessThan",    guarded<LessThan>,    data, RATIONAL_FAST_CALL(FastLessThan));
+	setPrototypeMethod(tpl, "greaterThan", guarded<GreaterThan>, data, RATIONAL_FAST_CALL(FastGreaterThan));
+	setPrototypeMethod(tpl, "equalTo",     guarded<EqualTo>,     data, RATIONAL_FAST_CALL(FastEqualTo));
+	setPrototypeMethod(tpl, "notEqualTo",  guarded<NotEqualTo>, data);
+
+	setPrototypeMethod(tpl, "valueOf", guarded<ValueOf>, data, RATIONAL_FAST_CALL(FastValueOf));
+	setPrototypeMethod(tpl, "toString", guarded<ToString>, data);
+	setPrototypeMethod(tpl, "toFixed",  guarded<ToFixed>,  data);
+	setPrototypeMethod(tpl, "toDecimalString", guarded<ToDecimalString>, data);
+
+	/* Static methods of the 'Rational' function. */
+	tpl->Set(
+		String::NewFromUtf8(isolate, "setCache").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<SetCache>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "fromNumber").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<FromNumber>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "add").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<AddInto>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "sub").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<SubInto>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "mul").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<MulInto>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "div").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<DivInto>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "pow").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<PowInto>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "neg").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<NegInto>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "abs").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<AbsInto>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "reduceAsync").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<ReduceAsync>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "sumAsync").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<SumAsync>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "sortAsync").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<SortAsync>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "parseAsync").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<ParseAsync>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "addArrays").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<AddArrays>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "subArrays").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<SubArrays>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "mulArrays").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<MulArrays>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "divArrays").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<DivArrays>, data));
+	tpl->Set(
+		String::NewFromUtf8(isolate, "compareArrays").ToLocalChecked(),
+		FunctionTemplate::New(isolate, guarded<CompareArrays>, data));
 
 	otpl->SetAccessor(
 		String::NewFromUtf8(isolate, "num").ToLocalChecked(),
@@ -121,7 +488,22 @@ void addon::WrappedRational::Init(Local<Object> exports){
 		String::NewFromUtf8(isolate, "den").ToLocalChecked(),
 		GetField, nullptr, Local<Value>(), DEFAULT,	DontEnum);
 
-	constructor.Reset(isolate, tpl->GetFunction(context).ToLocalChecked());
+	addonData->rationalConstructor.Reset(isolate, tpl->GetFunction(context).ToLocalChecked());
+	addonData->rationalTemplate.Reset(isolate, tpl);
+
+	/* Frozen constants shared by all the code of this environment, also reused by the cache. */
+	for(const auto& c : constants){
+		Local<Object> object = NewFrozen(isolate, addonData, rational<long>(c.num, c.den));
+
+		addonData->constants.emplace_back(isolate, object);
+
+		tpl->GetFunction(context).ToLocalChecked()->DefineOwnProperty(
+			context,
+			String::NewFromUtf8(isolate, c.name).ToLocalChecked(),
+			object,
+			static_cast<PropertyAttribute>(ReadOnly | DontDelete)
+		).Check();
+	}
 
 	/** @see https://v8docs.nodesource.com/node-20.3/db/d85/classv8_1_1_object.html#afa385ca327840d11af853537eacf8e8b */
 	exports->Set(
@@ -131,6 +513,92 @@ void addon::WrappedRational::Init(Local<Object> exports){
 	).Check();
 }
 
+addon::WrappedRational* addon::WrappedRational::FromValue(Isolate*, Local<Value> arg){
+	if(!arg->IsObject())
+		return nullptr;
+
+	Local<Object> object = arg.As<Object>();
+
+	if(object->InternalFieldCount() != 2 || object->GetAlignedPointerFromInternalField(1) != &brand)
+		return nullptr;
+
+	return ObjectWrap::Unwrap<WrappedRational>(object);
+}
+
+v8::Local<v8::Object> addon::WrappedRational::NewInstance(Isolate *isolate, const AddonData *addonData, const rational<long>& r){
+	Local<Object> object = Local<FunctionTemplate>::New(isolate, addonData->rationalTemplate)->InstanceTemplate()
+		->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
+
+	(new WrappedRational(r))->Attach(isolate, object);
+	return object;
+}
+
+v8::Local<v8::Object> addon::WrappedRational::NewFrozen(Isolate *isolate, const AddonData *addonData, const rational<long>& r){
+	Local<Object> object = NewInstance(isolate, addonData, r);
+
+	ObjectWrap::Unwrap<WrappedRational>(object)->frozen = true;
+	object->SetIntegrityLevel(isolate->GetCurrentContext(), v8::IntegrityLevel::kFrozen).Check();
+
+	return object;
+}
+
+v8::Local<v8::Object> addon::WrappedRational::NewResult(Isolate *isolate, AddonData *addonData, const rational<long>& r){
+	const long bound = addonData->cacheBound;
+
+	if(r.numerator() < -bound || r.numerator() > bound || r.denominator() > bound)
+		return NewInstance(isolate, addonData, r);
+
+	v8::Global<Object>& cached = addonData->cache[(r.numerator() + bound) * bound + r.denominator() - 1];
+
+	if(cached.IsEmpty()){
+		for(std::size_t i = 0; i < addonData->constants.size() && cached.IsEmpty(); i++)
+			if(r.numerator() == constants[i].num && r.denominator() == constants[i].den)
+				cached.Reset(isolate, addonData->constants[i].Get(isolate));
+
+		if(cached.IsEmpty())
+			cached.Reset(isolate, NewFrozen(isolate, addonData, r));
+	}
+
+	return cached.Get(isolate);
+}
+
+addon::WrappedRational* addon::WrappedRational::Mutable(Isolate *isolate, Local<Object> object){
+	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(object);
+
+	if(ptrWrappedRational->frozen){
+		throwException(isolate, Exception::TypeError, "Rational: immutable rational");
+		return nullptr;
+	}
+
+	return ptrWrappedRational;
+}
+
+void addon::WrappedRational::SetCache(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	long bound;
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!toInteger(isolate, args[0], bound)) return;
+
+	if(bound < 0 || bound > maxCacheBound){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
+
+	AddonData *addonData = AddonData::From(args);
+
+	addonData->cache.clear();
+	addonData->cache.resize((2 * bound + 1) * bound);
+	addonData->cacheBound = bound;
+}
+
 void addon::WrappedRational::New(const FunctionCallbackInfo<Value>& args){
 
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
@@ -155,66 +623,30 @@ void addon::WrappedRational::New(const FunctionCallbackInfo<Value>& args){
 			case 1:
 				if(args[0]->IsObject()){
 
-					Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-					String::Utf8Value str(isolate, constructor);
+					const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-					if(std::strcmp(*str, "Rational")){
+					if(!ptrOther){
 						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 						return;
 					}
 
-					Local<Value> numObj = args[0].As<Object>()->Get(
-							context,
-							String::NewFromUtf8(
-								isolate, "num").ToLocalChecked()
-							).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-					Local<Value> denObj = args[0].As<Object>()->Get(
-							context,
-							String::NewFromUtf8(
-								isolate, "den").ToLocalChecked()
-							).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-					long n = numObj.As<Number>()->Value();
-					long d = denObj.As<Number>()->Value();
-
-					obj = new WrappedRational(n, d);
+					obj = new WrappedRational(ptrOther->value);
 				}
 				else
-				if(args[0]->IsNumber()){
-
-					double value = args[0].As<Number>()->Value();
-					if(std::isnan(value)){
-						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-						return;
-					}
+				if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-					long n = value;
-					long d = 1L;
+					src::rational<long> r;
+					if(!toExact(isolate, args[0], r)) return;
 
-					obj = new WrappedRational(n, d);
-				}
-				else
-				if(args[0]->IsBigInt()){
-					throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-					return;
+					obj = new WrappedRational(r);
 				}
 				else
 				if(args[0]->IsString()){
 
-					String::Utf8Value str(isolate, args[0]);
-					char *end = NULL;
-
-					double value = std::strtol(*str, &end, 10);
-					if(*str == end || std::isnan(value)){
-						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-						return;
-					}
+					src::rational<long> r;
+					if(!toParsed(isolate, args[0], r)) return;
 
-					long n = value;
-					long d = 1L;
-
-					obj = new WrappedRational(n, d);
+					obj = new WrappedRational(r);
 				}
 				else{
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -224,98 +656,16 @@ void addon::WrappedRational::New(const FunctionCallbackInfo<Value>& args){
 
 			/* Two argument constructor */
 			case 2: {
-				if(args[0]->IsNumber() && args[1]->IsNumber()){
-
-					double val1 = args[0].As<Number>()->Value();
-					double val2 = args[1].As<Number>()->Value();
-					if(std::isnan(val1) || std::isnan(val2)){
-						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-						return;
-					}
+				if(isTerm(args[0]) && isTerm(args[1])){
 
-					long n = val1;
-					long d = val2;
+					src::rational<long> n, d;
+					if(!toTerm(isolate, args[0], n) || !toTerm(isolate, args[1], d)) return;
 
-					if(d == 0){
+					if(!d){
 						throwException(isolate, Exception::TypeError, "Rational: bad rational, zero denominator");
 						return;
 					}
-					obj = new WrappedRational(n, d);
-				}
-				else
-				if(args[0]->IsBigInt() || args[1]->IsBigInt()){
-					throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-					return;
-				}
-				else
-				if(args[0]->IsString() || args[1]->IsString()){
-					long n, d;
-
-					if(args[0]->IsString()){
-						String::Utf8Value str(isolate, args[0]);
-						char *end = NULL;
-
-						double value = std::strtol(*str, &end, 10);
-						if(*str == end || std::isnan(value)){
-							throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-							return;
-						}
-						n = value;
-
-						if(args[1]->IsNumber()){
-							double value = args[1].As<Number>()->Value();
-							if(std::isnan(value)){
-								throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-								return;
-							}
-							d = value;
-						}
-						else
-						if(args[1]->IsString()){
-							String::Utf8Value str(isolate, args[1]);
-							char *end = NULL;
-
-							double value = std::strtol(*str, &end, 10);
-							if(*str == end || std::isnan(value)){
-								throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-								return;
-							}
-							d = value;
-						}
-						else{
-							throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-							return;
-						}
-					}
-					else
-					if(args[0]->IsNumber()){
-						double value = args[0].As<Number>()->Value();
-						if(std::isnan(value)){
-							throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-							return;
-						}
-						n = value;
-
-						String::Utf8Value str(isolate, args[1]);
-						char *end = NULL;
-
-						value = std::strtol(*str, &end, 10);
-						if(*str == end || std::isnan(value)){
-							throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-							return;
-						}
-						d = value;
-					}
-					else{
-						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-						return;
-					}
-
-					if(d == 0){
-						throwException(isolate, Exception::TypeError, "Rational: bad rational, zero denominator");
-						return;
-					}
-					obj = new WrappedRational(n, d);
+					obj = new WrappedRational(n / d);
 				}
 				else{
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -329,37 +679,34 @@ void addon::WrappedRational::New(const FunctionCallbackInfo<Value>& args){
 				return;
 		}
 
-		obj->Wrap(args.This());
+		obj->Attach(isolate, args.This());
 		args.GetReturnValue().Set(args.This());
 	}
 	// Invoked as plain function `Rational(...)`, turn into construct call.
 	else{
-		Local<Function> cons = Local<Function>::New(isolate, constructor);
+		Local<Function> cons = Local<Function>::New(isolate, AddonData::From(args)->rationalConstructor);
 		int argc = args.Length();
 
+		/* An exception thrown by the constructor stays pending for the caller. */
+		Local<Object> instance;
+
 		switch(args.Length()){
 			case 0: {
 				Local<Value> *argv = nullptr;
-				args.GetReturnValue()
-					.Set(cons->NewInstance(context, argc, argv)
-						.ToLocalChecked()
-				);
+				if(cons->NewInstance(context, argc, argv).ToLocal(&instance))
+					args.GetReturnValue().Set(instance);
 			}
 			break;
 			case 1: {
 				Local<Value> argv[] = { args[0] };
-				args.GetReturnValue()
-					.Set(cons->NewInstance(context, argc, argv)
-						.ToLocalChecked()
-				);
+				if(cons->NewInstance(context, argc, argv).ToLocal(&instance))
+					args.GetReturnValue().Set(instance);
 			}
 			break;
 			case 2: {
 				Local<Value> argv[] = { args[0], args[1] };
-				args.GetReturnValue()
-					.Set(cons->NewInstance(context, argc, argv)
-						.ToLocalChecked()
-				);
+				if(cons->NewInstance(context, argc, argv).ToLocal(&instance))
+					args.GetReturnValue().Set(instance);
 			}
 			break;
 			default: {
@@ -384,7 +731,7 @@ void addon::WrappedRational::GetNumerator(const FunctionCallbackInfo<Value>& arg
 	Isolate *isolate = args.GetIsolate();
 
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-	long num = ptrWrappedRational->ptrRational->numerator();
+	long num = ptrWrappedRational->value.numerator();
 
 	args.GetReturnValue().Set(Number::New(isolate, num));
 }
@@ -395,7 +742,7 @@ void addon::WrappedRational::GetDenominator(const FunctionCallbackInfo<Value>& a
 	Isolate *isolate = args.GetIsolate();
 
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-	long den = ptrWrappedRational->ptrRational->denominator();
+	long den = ptrWrappedRational->value.denominator();
 
 	args.GetReturnValue().Set(Number::New(isolate, den));
 }
@@ -405,75 +752,37 @@ void addon::WrappedRational::Assign(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
 
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
-
-				ptrWrappedRational->ptrRational->assign(n, d);
+				ptrWrappedRational->value = ptrOther->value;
 			}
 			else
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				long n = value;
-				long d = 1L;
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
-				ptrWrappedRational->ptrRational->assign(n, d);
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				ptrWrappedRational->value = r;
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
-
-				ptrWrappedRational->ptrRational->assign(n, d);
+				ptrWrappedRational->value = r;
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -482,99 +791,17 @@ void addon::WrappedRational::Assign(const FunctionCallbackInfo<Value>& args){
 		break;
 
 		case 2: {
-			if(args[0]->IsNumber() && args[1]->IsNumber()){
-
-				double val1 = args[0].As<Number>()->Value();
-				double val2 = args[1].As<Number>()->Value();
-				if(std::isnan(val1) || std::isnan(val2)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+			if(isTerm(args[0]) && isTerm(args[1])){
 
-				long n = val1;
-				long d = val2;
+				src::rational<long> n, d;
+				if(!toTerm(isolate, args[0], n) || !toTerm(isolate, args[1], d)) return;
 
-				if(d == 0){
+				if(!d){
 					throwException(isolate, Exception::TypeError, "Rational: bad rational, zero denominator");
 					return;
 				}
 
-				ptrWrappedRational->ptrRational->assign(n, d);
-			}
-			else
-			if(args[0]->IsBigInt() || args[1]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
-			}
-			else
-			if(args[0]->IsString() || args[1]->IsString()){
-				long n, d;
-
-				if(args[0]->IsString()){
-					String::Utf8Value str(isolate, args[0]);
-					char *end = NULL;
-
-					double value = std::strtol(*str, &end, 10);
-					if(*str == end || std::isnan(value)){
-						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-						return;
-					}
-					n = value;
-
-					if(args[1]->IsNumber()){
-						double value = args[1].As<Number>()->Value();
-						if(std::isnan(value)){
-							throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-							return;
-						}
-						d = value;
-					}
-					else
-					if(args[1]->IsString()){
-						String::Utf8Value str(isolate, args[1]);
-						char *end = NULL;
-
-						double value = std::strtol(*str, &end, 10);
-						if(*str == end || std::isnan(value)){
-							throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-							return;
-						}
-						d = value;
-					}
-					else{
-						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-						return;
-					}
-				}
-				else
-				if(args[0]->IsNumber()){
-					double value = args[0].As<Number>()->Value();
-					if(std::isnan(value)){
-						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-						return;
-					}
-					n = value;
-
-					String::Utf8Value str(isolate, args[1]);
-					char *end = NULL;
-
-					value = std::strtol(*str, &end, 10);
-					if(*str == end || std::isnan(value)){
-						throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-						return;
-					}
-					d = value;
-				}
-				else{
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				if(d == 0){
-					throwException(isolate, Exception::TypeError, "Rational: bad rational, zero denominator");
-					return;
-				}
-				ptrWrappedRational->ptrRational->assign(n, d);
+				ptrWrappedRational->value = n / d;
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -594,78 +821,38 @@ void addon::WrappedRational::SelfAdd(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
 
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
-
-				if(std::strcmp(*str, "Rational")){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator +=(rational);
-			}
-			else
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				long n = value;
-				long d = 1L;
-
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator +=(rational);
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				src::rational<long> rational = ptrOther->value;
+				ptrWrappedRational->value.operator +=(rational);
 			}
 			else
-			if(args[0]->IsString()){
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
+				src::rational<long> rational;
+				if(!toExact(isolate, args[0], rational)) return;
 
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				ptrWrappedRational->value.operator +=(rational);
+			}
+			else
+			if(args[0]->IsString()){
 
-				long n = value;
-				long d = 1L;
+				src::rational<long> rational;
+				if(!toParsed(isolate, args[0], rational)) return;
 
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator +=(rational);
+				ptrWrappedRational->value.operator +=(rational);
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -686,78 +873,38 @@ void addon::WrappedRational::SelfSub(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
 
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
-
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator -=(rational);
+				src::rational<long> rational = ptrOther->value;
+				ptrWrappedRational->value.operator -=(rational);
 			}
 			else
-			if(args[0]->IsNumber()){
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
+				src::rational<long> rational;
+				if(!toExact(isolate, args[0], rational)) return;
 
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator -=(rational);
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				ptrWrappedRational->value.operator -=(rational);
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
+				src::rational<long> rational;
+				if(!toParsed(isolate, args[0], rational)) return;
 
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
-
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator -=(rational);
+				ptrWrappedRational->value.operator -=(rational);
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -778,78 +925,38 @@ void addon::WrappedRational::SelfMul(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
 
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
-
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator *=(rational);
+				src::rational<long> rational = ptrOther->value;
+				ptrWrappedRational->value.operator *=(rational);
 			}
 			else
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				long n = value;
-				long d = 1L;
+				src::rational<long> rational;
+				if(!toExact(isolate, args[0], rational)) return;
 
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator *=(rational);
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				ptrWrappedRational->value.operator *=(rational);
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
+				src::rational<long> rational;
+				if(!toParsed(isolate, args[0], rational)) return;
 
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator *=(rational);
+				ptrWrappedRational->value.operator *=(rational);
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -870,37 +977,22 @@ void addon::WrappedRational::SelfDiv(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
 
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
+				long n = ptrOther->value.numerator();
+				long d = ptrOther->value.denominator();
 
 				if(n == 0){
 					throwException(isolate, Exception::TypeError, "Rational: division by zero");
@@ -908,55 +1000,33 @@ void addon::WrappedRational::SelfDiv(const FunctionCallbackInfo<Value>& args){
 				}
 
 				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator /=(rational);
+				ptrWrappedRational->value.operator /=(rational);
 			}
 			else
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				long n = value;
-				long d = 1L;
+				src::rational<long> rational;
+				if(!toExact(isolate, args[0], rational)) return;
 
-				if(n == 0){
+				if(!rational){
 					throwException(isolate, Exception::TypeError, "Rational: division by zero");
 					return;
 				}
 
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator /=(rational);
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				ptrWrappedRational->value.operator /=(rational);
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
+				src::rational<long> rational;
+				if(!toParsed(isolate, args[0], rational)) return;
 
-				if(n == 0){
+				if(!rational){
 					throwException(isolate, Exception::TypeError, "Rational: division by zero");
 					return;
 				}
 
-				src::rational<long> rational(n, d);
-				ptrWrappedRational->ptrRational->operator /=(rational);
+				ptrWrappedRational->value.operator /=(rational);
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -977,70 +1047,42 @@ void addon::WrappedRational::SelfPow(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
 
 	switch(args.Length()){
 		case 1:
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				src::rational<long> r(1);
-				for(long i = 0; i < std::abs(n); i++)
-					r *= *(ptrWrappedRational->ptrRational);
+				long n;
+				if(!toIntegral(isolate, args[0], n)) return;
 
-				if(n < 1){
-					if(r.numerator() == 0){
-						throwException(isolate, Exception::TypeError, "Rational: division by zero");
-						return;
-					}
-					src::rational<long> u(1);
-					u /= r;
-					r.assign(u.numerator(), u.denominator());
+				if(n < 0 && !ptrWrappedRational->value){
+					throwException(isolate, Exception::TypeError, "Rational: division by zero");
+					return;
 				}
 
-				ptrWrappedRational->ptrRational->assign(r.numerator(), r.denominator());
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				ptrWrappedRational->value = src::pow(ptrWrappedRational->value, n);
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
+				src::rational<long> e;
+				if(!toParsed(isolate, args[0], e)) return;
 
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
+				if(e.denominator() != 1){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				long n = value;
-
-				src::rational<long> r(1);
-				for(long i = 0; i < std::abs(n); i++)
-					r *= *(ptrWrappedRational->ptrRational);
+				const long n = e.numerator();
 
-				if(n < 1){
-					if(r.numerator() == 0){
-						throwException(isolate, Exception::TypeError, "Rational: division by zero");
-						return;
-					}
-					src::rational<long> u(1);
-					u /= r;
-					r.assign(u.numerator(), u.denominator());
+				if(n < 0 && !ptrWrappedRational->value){
+					throwException(isolate, Exception::TypeError, "Rational: division by zero");
+					return;
 				}
 
-				ptrWrappedRational->ptrRational->assign(r.numerator(), r.denominator());
+				ptrWrappedRational->value = src::pow(ptrWrappedRational->value, n);
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -1061,9 +1103,6 @@ void addon::WrappedRational::Add(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
 	long n, d;
 
@@ -1071,60 +1110,33 @@ void addon::WrappedRational::Add(const FunctionCallbackInfo<Value>& args){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				n = numObj.As<Number>()->Value();
-				d = denObj.As<Number>()->Value();
+				n = ptrOther->value.numerator();
+				d = ptrOther->value.denominator();
 			}
 			else
-			if(args[0]->IsNumber()){
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
-				n = value;
-				d = 1L;
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				n = r.numerator();
+				d = r.denominator();
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
-				n = value;
-				d = 1L;
+				n = r.numerator();
+				d = r.denominator();
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -1138,19 +1150,9 @@ void addon::WrappedRational::Add(const FunctionCallbackInfo<Value>& args){
 	}
 
 	src::rational<long> rational(n, d);
-	src::rational<long> retRational = src::operator+(*(ptrWrappedRational->ptrRational), rational);
-
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, retRational.numerator()),
-		Number::New(isolate, retRational.denominator())
-	};
+	src::rational<long> retRational = src::operator+(ptrWrappedRational->value, rational);
 
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-		.ToLocalChecked()
-	);
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
 }
 
 void addon::WrappedRational::Sub(const FunctionCallbackInfo<Value>& args){
@@ -1158,9 +1160,6 @@ void addon::WrappedRational::Sub(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
 	long n, d;
 
@@ -1168,60 +1167,33 @@ void addon::WrappedRational::Sub(const FunctionCallbackInfo<Value>& args){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				n = numObj.As<Number>()->Value();
-				d = denObj.As<Number>()->Value();
+				n = ptrOther->value.numerator();
+				d = ptrOther->value.denominator();
 			}
 			else
-			if(args[0]->IsNumber()){
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
-				n = value;
-				d = 1L;
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				n = r.numerator();
+				d = r.denominator();
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
-				n = value;
-				d = 1L;
+				n = r.numerator();
+				d = r.denominator();
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -1235,19 +1207,9 @@ void addon::WrappedRational::Sub(const FunctionCallbackInfo<Value>& args){
 	}
 
 	src::rational<long> rational(n, d);
-	src::rational<long> retRational = src::operator-(*(ptrWrappedRational->ptrRational), rational);
-
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, retRational.numerator()),
-		Number::New(isolate, retRational.denominator())
-	};
+	src::rational<long> retRational = src::operator-(ptrWrappedRational->value, rational);
 
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-		.ToLocalChecked()
-	);
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
 }
 
 void addon::WrappedRational::Mul(const FunctionCallbackInfo<Value>& args){
@@ -1255,9 +1217,6 @@ void addon::WrappedRational::Mul(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
 	long n, d;
 
@@ -1265,60 +1224,33 @@ void addon::WrappedRational::Mul(const FunctionCallbackInfo<Value>& args){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				n = numObj.As<Number>()->Value();
-				d = denObj.As<Number>()->Value();
+				n = ptrOther->value.numerator();
+				d = ptrOther->value.denominator();
 			}
 			else
-			if(args[0]->IsNumber()){
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
-				n = value;
-				d = 1L;
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				n = r.numerator();
+				d = r.denominator();
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
-				n = value;
-				d = 1L;
+				n = r.numerator();
+				d = r.denominator();
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -1332,19 +1264,9 @@ void addon::WrappedRational::Mul(const FunctionCallbackInfo<Value>& args){
 	}
 
 	src::rational<long> rational(n, d);
-	src::rational<long> retRational = src::operator*(*(ptrWrappedRational->ptrRational), rational);
-
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, retRational.numerator()),
-		Number::New(isolate, retRational.denominator())
-	};
+	src::rational<long> retRational = src::operator*(ptrWrappedRational->value, rational);
 
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-		.ToLocalChecked()
-	);
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
 }
 
 void addon::WrappedRational::Div(const FunctionCallbackInfo<Value>& args){
@@ -1352,9 +1274,6 @@ void addon::WrappedRational::Div(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
 	long n, d;
 
@@ -1362,28 +1281,15 @@ void addon::WrappedRational::Div(const FunctionCallbackInfo<Value>& args){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				n = numObj.As<Number>()->Value();
-				d = denObj.As<Number>()->Value();
+				n = ptrOther->value.numerator();
+				d = ptrOther->value.denominator();
 
 				if(n == 0){
 					throwException(isolate, Exception::TypeError, "Rational: division by zero");
@@ -1391,16 +1297,13 @@ void addon::WrappedRational::Div(const FunctionCallbackInfo<Value>& args){
 				}
 			}
 			else
-			if(args[0]->IsNumber()){
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
-				n = value;
-				d = 1L;
+				n = r.numerator();
+				d = r.denominator();
 
 				if(n == 0){
 					throwException(isolate, Exception::TypeError, "Rational: division by zero");
@@ -1408,24 +1311,13 @@ void addon::WrappedRational::Div(const FunctionCallbackInfo<Value>& args){
 				}
 			}
 			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
-			}
-			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
-				n = value;
-				d = 1L;
+				n = r.numerator();
+				d = r.denominator();
 
 				if(n == 0){
 					throwException(isolate, Exception::TypeError, "Rational: division by zero");
@@ -1444,19 +1336,9 @@ void addon::WrappedRational::Div(const FunctionCallbackInfo<Value>& args){
 	}
 
 	src::rational<long> rational(n, d);
-	src::rational<long> retRational = src::operator/(*(ptrWrappedRational->ptrRational), rational);
-
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, retRational.numerator()),
-		Number::New(isolate, retRational.denominator())
-	};
+	src::rational<long> retRational = src::operator/(ptrWrappedRational->value, rational);
 
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-		.ToLocalChecked()
-	);
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
 }
 
 void addon::WrappedRational::Pow(const FunctionCallbackInfo<Value>& args){
@@ -1464,66 +1346,42 @@ void addon::WrappedRational::Pow(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
 	src::rational<long> r(1);
 
 	switch(args.Length()){
 		case 1:
-			if(args[0]->IsNumber()){
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				long n;
+				if(!toIntegral(isolate, args[0], n)) return;
+
+				if(n < 0 && !ptrWrappedRational->value){
+					throwException(isolate, Exception::TypeError, "Rational: division by zero");
 					return;
 				}
 
-				long n = value;
-				for(long i = 0; i < std::abs(n); i++)
-					r *= *(ptrWrappedRational->ptrRational);
-
-				if(n < 1){
-					if(r.numerator() == 0){
-						throwException(isolate, Exception::TypeError, "Rational: division by zero");
-						return;
-					}
-					src::rational<long> u(1);
-					u /= r;
-					r.assign(u.numerator(), u.denominator());
-				}
-			}
-			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
+				r = src::pow(ptrWrappedRational->value, n);
 			}
 			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
+				src::rational<long> e;
+				if(!toParsed(isolate, args[0], e)) return;
 
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
+				if(e.denominator() != 1){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				long n = value;
-				for(long i = 0; i < std::abs(n); i++)
-					r *= *(ptrWrappedRational->ptrRational);
+				const long n = e.numerator();
 
-				if(n < 1){
-					if(r.numerator() == 0){
-						throwException(isolate, Exception::TypeError, "Rational: division by zero");
-						return;
-					}
-					src::rational<long> u(1);
-					u /= r;
-					r.assign(u.numerator(), u.denominator());
+				if(n < 0 && !ptrWrappedRational->value){
+					throwException(isolate, Exception::TypeError, "Rational: division by zero");
+					return;
 				}
+
+				r = src::pow(ptrWrappedRational->value, n);
 			}
 			else{
 				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
@@ -1536,22 +1394,13 @@ void addon::WrappedRational::Pow(const FunctionCallbackInfo<Value>& args){
 			return;
 	}
 
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, r.numerator()),
-		Number::New(isolate, r.denominator())
-	};
-
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-		.ToLocalChecked()
-	);
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), r));
 }
 
 void addon::WrappedRational::PreInc(const FunctionCallbackInfo<Value>& args){
 
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
 
 	if(args.Length() > 0){
 		Isolate *isolate = args.GetIsolate();
@@ -1559,13 +1408,14 @@ void addon::WrappedRational::PreInc(const FunctionCallbackInfo<Value>& args){
 		return;
 	}
 
-	++(*ptrWrappedRational->ptrRational);
+	++(ptrWrappedRational->value);
 	args.GetReturnValue().Set(args.This());
 }
 
 void addon::WrappedRational::PreDec(const FunctionCallbackInfo<Value>& args){
 
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
 
 	if(args.Length() > 0){
 		Isolate *isolate = args.GetIsolate();
@@ -1573,7 +1423,7 @@ void addon::WrappedRational::PreDec(const FunctionCallbackInfo<Value>& args){
 		return;
 	}
 
-	--(*ptrWrappedRational->ptrRational);
+	--(ptrWrappedRational->value);
 	args.GetReturnValue().Set(args.This());
 }
 
@@ -1582,156 +1432,260 @@ void addon::WrappedRational::PostInc(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
+	src::rational<long> retRational = ptrWrappedRational->value;
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	(ptrWrappedRational->value)++;
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), retRational));
+}
+
+void addon::WrappedRational::PostDec(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
+	src::rational<long> retRational = ptrWrappedRational->value;
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	(ptrWrappedRational->value)--;
+
+	args.GetReturnValue().Set(NewInstance(isolate, AddonData::From(args), retRational));
+}
+
+void addon::WrappedRational::SelfNeg(const FunctionCallbackInfo<Value>& args){
+
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
+
+	if(args.Length() > 0){
+		Isolate *isolate = args.GetIsolate();
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	ptrWrappedRational->value *= -1;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedRational::SelfAbs(const FunctionCallbackInfo<Value>& args){
+
+	WrappedRational *ptrWrappedRational = Mutable(args.GetIsolate(), args.Holder());
+	if(!ptrWrappedRational) return;
+
+	if(args.Length() > 0){
+		Isolate *isolate = args.GetIsolate();
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(ptrWrappedRational->value < 0L)
+		ptrWrappedRational->value *= -1;
+
+	args.GetReturnValue().Set(args.This());
+}
+
+void addon::WrappedRational::Neg(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+
+	if(args.Length() > 0){
+		Isolate *isolate = args.GetIsolate();
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	src::rational<long> retRational = src::operator-(ptrWrappedRational->value);
+
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
+}
+
+void addon::WrappedRational::Abs(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-	long n = ptrWrappedRational->ptrRational->numerator();
-	long d = ptrWrappedRational->ptrRational->denominator();
 
 	if(args.Length() > 0){
+		Isolate *isolate = args.GetIsolate();
 		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
 		return;
 	}
 
-	(*ptrWrappedRational->ptrRational)++;
+	src::rational<long> retRational = src::abs(ptrWrappedRational->value);
 
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, n),
-		Number::New(isolate, d)
-	};
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
+}
+
+void addon::WrappedRational::AddInto(const FunctionCallbackInfo<Value>& args){
+	rational<long> a[2];
 
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-			.ToLocalChecked()
-		);
+	WrappedRational *out = toOperands(args, 3, a);
+	if(!out) return;
+
+	out->value = a[0] + a[1];
+
+	args.GetReturnValue().Set(args[2]);
 }
 
-void addon::WrappedRational::PostDec(const FunctionCallbackInfo<Value>& args){
+void addon::WrappedRational::SubInto(const FunctionCallbackInfo<Value>& args){
+	rational<long> a[2];
 
-	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
-	Isolate *isolate = args.GetIsolate();
+	WrappedRational *out = toOperands(args, 3, a);
+	if(!out) return;
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
+	out->value = a[0] - a[1];
 
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-	long n = ptrWrappedRational->ptrRational->numerator();
-	long d = ptrWrappedRational->ptrRational->denominator();
+	args.GetReturnValue().Set(args[2]);
+}
 
-	if(args.Length() > 0){
-		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
-		return;
-	}
+void addon::WrappedRational::MulInto(const FunctionCallbackInfo<Value>& args){
+	rational<long> a[2];
 
-	(*ptrWrappedRational->ptrRational)--;
+	WrappedRational *out = toOperands(args, 3, a);
+	if(!out) return;
 
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, n),
-		Number::New(isolate, d)
-	};
+	out->value = a[0] * a[1];
 
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-			.ToLocalChecked()
-		);
+	args.GetReturnValue().Set(args[2]);
 }
 
-void addon::WrappedRational::SelfNeg(const FunctionCallbackInfo<Value>& args){
+void addon::WrappedRational::DivInto(const FunctionCallbackInfo<Value>& args){
+	rational<long> a[2];
 
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *out = toOperands(args, 3, a);
+	if(!out) return;
 
-	if(args.Length() > 0){
-		Isolate *isolate = args.GetIsolate();
-		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+	if(!a[1]){
+		throwException(args.GetIsolate(), Exception::TypeError, "Rational: division by zero");
 		return;
 	}
 
-	*ptrWrappedRational->ptrRational *= -1;
+	out->value = a[0] / a[1];
 
-	args.GetReturnValue().Set(args.This());
+	args.GetReturnValue().Set(args[2]);
 }
 
-void addon::WrappedRational::SelfAbs(const FunctionCallbackInfo<Value>& args){
+void addon::WrappedRational::PowInto(const FunctionCallbackInfo<Value>& args){
+	rational<long> a[2];
 
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+	WrappedRational *out = toOperands(args, 3, a);
+	if(!out) return;
 
-	if(args.Length() > 0){
-		Isolate *isolate = args.GetIsolate();
-		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+	if(a[1].denominator() != 1L){
+		throwException(args.GetIsolate(), Exception::TypeError, "Rational: invalid argument");
 		return;
 	}
 
-	if(*ptrWrappedRational->ptrRational < 0L)
-		*ptrWrappedRational->ptrRational *= -1;
+	if(a[1] < 0L && !a[0]){
+		throwException(args.GetIsolate(), Exception::TypeError, "Rational: division by zero");
+		return;
+	}
 
-	args.GetReturnValue().Set(args.This());
+	out->value = src::pow(a[0], a[1].numerator());
+
+	args.GetReturnValue().Set(args[2]);
 }
 
-void addon::WrappedRational::Neg(const FunctionCallbackInfo<Value>& args){
+void addon::WrappedRational::NegInto(const FunctionCallbackInfo<Value>& args){
+	rational<long> a[1];
+
+	WrappedRational *out = toOperands(args, 2, a);
+	if(!out) return;
+
+	out->value = src::operator-(a[0]);
+
+	args.GetReturnValue().Set(args[1]);
+}
+
+void addon::WrappedRational::AbsInto(const FunctionCallbackInfo<Value>& args){
+	rational<long> a[1];
+
+	WrappedRational *out = toOperands(args, 2, a);
+	if(!out) return;
+
+	out->value = src::abs(a[0]);
+
+	args.GetReturnValue().Set(args[1]);
+}
+
+void addon::WrappedRational::LimitDenominator(const FunctionCallbackInfo<Value>& args){
 
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
 
-	if(args.Length() > 0){
-		Isolate *isolate = args.GetIsolate();
+	if(args.Length() != 1){
 		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
 		return;
 	}
 
-	src::rational<long> retRational = src::operator-(*(ptrWrappedRational->ptrRational));
+	long bound;
+	if(!toBound(isolate, args[0], bound)) return;
 
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, retRational.numerator()),
-		Number::New(isolate, retRational.denominator())
-	};
+	src::rational<long> retRational = src::limit_denominator(ptrWrappedRational->value, bound);
 
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-		.ToLocalChecked()
-	);
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
 }
 
-void addon::WrappedRational::Abs(const FunctionCallbackInfo<Value>& args){
+void addon::WrappedRational::FromNumber(const FunctionCallbackInfo<Value>& args){
 
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
-	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-
-	if(args.Length() > 0){
-		Isolate *isolate = args.GetIsolate();
+	if(args.Length() != 1 && args.Length() != 2){
 		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
 		return;
 	}
 
-	src::rational<long> retRational = src::abs(*(ptrWrappedRational->ptrRational));
+	if(!args[0]->IsNumber() && !args[0]->IsBigInt()){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
+
+	src::rational<long> retRational;
 
-	Local<Function> cons = Local<Function>::New(isolate, constructor);
-	int argc = 2;
-	Local<Value> argv[] = {
-		Number::New(isolate, retRational.numerator()),
-		Number::New(isolate, retRational.denominator())
-	};
+	if(args.Length() == 1){
+		if(!toExact(isolate, args[0], retRational)) return;
+	}
+	else{
+		long bound;
+		if(!toBound(isolate, args[1], bound)) return;
 
-	args.GetReturnValue()
-		.Set(cons->NewInstance(context, argc, argv)
-		.ToLocalChecked()
-	);
+		if(args[0]->IsBigInt()){
+			if(!toExact(isolate, args[0], retRational)) return;
+		}
+		else{
+			const double value = args[0].As<Number>()->Value();
+
+			if(std::isnan(value)){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return;
+			}
+
+			retRational = approximate(value, bound);
+		}
+	}
+
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
 }
 
 void addon::WrappedRational::Not(const FunctionCallbackInfo<Value>& args){
@@ -1746,7 +1700,7 @@ void addon::WrappedRational::Not(const FunctionCallbackInfo<Value>& args){
 		return;
 	}
 
-	Local<Boolean> retval = Boolean::New(isolate, !(*ptrWrappedRational->ptrRational));
+	Local<Boolean> retval = Boolean::New(isolate, !(ptrWrappedRational->value));
 	args.GetReturnValue().Set(retval);
 }
 
@@ -1762,7 +1716,7 @@ void addon::WrappedRational::Bool(const FunctionCallbackInfo<Value>& args){
 		return;
 	}
 
-	Local<Boolean> retval = Boolean::New(isolate, static_cast<bool>(*ptrWrappedRational->ptrRational));
+	Local<Boolean> retval = Boolean::New(isolate, static_cast<bool>(ptrWrappedRational->value));
 	args.GetReturnValue().Set(retval);
 }
 
@@ -1771,83 +1725,43 @@ void addon::WrappedRational::LessThan(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
-				src::rational<long> r(n, d);
+				src::rational<long> r = ptrOther->value;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational < r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value < r);
 
 				args.GetReturnValue().Set(retval);
 			}
 			else
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				long n = value;
-				long d = 1L;
-				src::rational<long> r(n, d);
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational < r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value < r);
 
 				args.GetReturnValue().Set(retval);
 			}
 			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
-			}
-			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
-				src::rational<long> r(n, d);
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational < r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value < r);
 
 				args.GetReturnValue().Set(retval);
 			}
@@ -1868,83 +1782,43 @@ void addon::WrappedRational::GreaterThan(const FunctionCallbackInfo<Value>& args
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
-				src::rational<long> r(n, d);
+				src::rational<long> r = ptrOther->value;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational > r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value > r);
 
 				args.GetReturnValue().Set(retval);
 			}
 			else
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				long n = value;
-				long d = 1L;
-				src::rational<long> r(n, d);
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational > r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value > r);
 
 				args.GetReturnValue().Set(retval);
 			}
 			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
-			}
-			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
-				src::rational<long> r(n, d);
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational > r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value > r);
 
 				args.GetReturnValue().Set(retval);
 			}
@@ -1965,83 +1839,43 @@ void addon::WrappedRational::EqualTo(const FunctionCallbackInfo<Value>& args){
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
-				src::rational<long> r(n, d);
+				src::rational<long> r = ptrOther->value;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational == r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value == r);
 
 				args.GetReturnValue().Set(retval);
 			}
 			else
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				long n = value;
-				long d = 1L;
-				src::rational<long> r(n, d);
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational == r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value == r);
 
 				args.GetReturnValue().Set(retval);
 			}
 			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
-			}
-			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
-				src::rational<long> r(n, d);
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, *ptrWrappedRational->ptrRational == r);
+				Local<Boolean> retval = Boolean::New(isolate, ptrWrappedRational->value == r);
 
 				args.GetReturnValue().Set(retval);
 			}
@@ -2062,83 +1896,43 @@ void addon::WrappedRational::NotEqualTo(const FunctionCallbackInfo<Value>& args)
 	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
 	Isolate *isolate = args.GetIsolate();
 
-	/* Context of the currently running JavaScript instance. */
-	Local<Context> context = isolate->GetCurrentContext();
-
 	switch(args.Length()){
 		case 1:
 			if(args[0]->IsObject()){
 
-				Local<String> constructor = args[0].As<Object>()->GetConstructorName();
-				String::Utf8Value str(isolate, constructor);
+				const WrappedRational *ptrOther = FromValue(isolate, args[0]);
 
-				if(std::strcmp(*str, "Rational")){
+				if(!ptrOther){
 					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
 					return;
 				}
 
-				Local<Value> numObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "num").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				Local<Value> denObj = args[0].As<Object>()->Get(
-					context,
-					String::NewFromUtf8(
-						isolate, "den").ToLocalChecked()
-					).ToLocalChecked(); /* Converts this MaybeLocal<> to a Local<>. */
-
-				long n = numObj.As<Number>()->Value();
-				long d = denObj.As<Number>()->Value();
-				src::rational<long> r(n, d);
+				src::rational<long> r = ptrOther->value;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, !(*ptrWrappedRational->ptrRational == r));
+				Local<Boolean> retval = Boolean::New(isolate, !(ptrWrappedRational->value == r));
 
 				args.GetReturnValue().Set(retval);
 			}
 			else
-			if(args[0]->IsNumber()){
-
-				double value = args[0].As<Number>()->Value();
-				if(std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
+			if(args[0]->IsNumber() || args[0]->IsBigInt()){
 
-				long n = value;
-				long d = 1L;
-				src::rational<long> r(n, d);
+				src::rational<long> r;
+				if(!toExact(isolate, args[0], r)) return;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, !(*ptrWrappedRational->ptrRational == r));
+				Local<Boolean> retval = Boolean::New(isolate, !(ptrWrappedRational->value == r));
 
 				args.GetReturnValue().Set(retval);
 			}
 			else
-			if(args[0]->IsBigInt()){
-				throwException(isolate, Exception::TypeError, "Rational: BigInt type is not accepted");
-				return;
-			}
-			else
 			if(args[0]->IsString()){
 
-				String::Utf8Value str(isolate, args[0]);
-				char *end = NULL;
-
-				double value = std::strtol(*str, &end, 10);
-				if(*str == end || std::isnan(value)){
-					throwException(isolate, Exception::TypeError, "Rational: invalid argument");
-					return;
-				}
-
-				long n = value;
-				long d = 1L;
-				src::rational<long> r(n, d);
+				src::rational<long> r;
+				if(!toParsed(isolate, args[0], r)) return;
 
 				WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
-				Local<Boolean> retval = Boolean::New(isolate, !(*ptrWrappedRational->ptrRational == r));
+				Local<Boolean> retval = Boolean::New(isolate, !(ptrWrappedRational->value == r));
 
 				args.GetReturnValue().Set(retval);
 			}
@@ -2166,7 +1960,7 @@ void addon::WrappedRational::ValueOf(const FunctionCallbackInfo<Value>& args){
 		return;
 	}
 
-	Local<Number> retval = Number::New(isolate, src::rational_cast<double, long>(*ptrWrappedRational->ptrRational));
+	Local<Number> retval = Number::New(isolate, src::rational_cast<double, long>(ptrWrappedRational->value));
 
 	args.GetReturnValue().Set(retval);
 }
@@ -2183,24 +1977,152 @@ void addon::WrappedRational::ToString(const FunctionCallbackInfo<Value>& args){
 		return;
 	}
 
-	std::ostringstream ss;
+	char buf[2 * (std::numeric_limits<long>::digits10 + 2) + 1];
+	const std::to_chars_result res = src::to_chars(buf, buf + sizeof(buf), ptrWrappedRational->value);
+
+	Local<String> retval = String::NewFromUtf8(isolate, buf, NewStringType::kNormal, static_cast<int>(res.ptr - buf)).ToLocalChecked();
+
+	args.GetReturnValue().Set(retval);
+}
+
+void addon::WrappedRational::Floor(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	src::rational<long> retRational(src::floor(ptrWrappedRational->value));
+
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
+}
+
+void addon::WrappedRational::Ceil(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+
+	if(args.Length() > 0){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	src::rational<long> retRational(src::ceil(ptrWrappedRational->value));
+
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
+}
+
+void addon::WrappedRational::Round(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+
+	if(args.Length() > 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	/* An undefined argument taken as omitted, as by default parameters. */
+	src::rounding mode = src::rounding::half_even;
+	if(args.Length() == 1 && !args[0]->IsUndefined() && !toRounding(isolate, args[0], mode)) return;
+
+	src::rational<long> retRational(src::round(ptrWrappedRational->value, mode));
+
+	args.GetReturnValue().Set(NewResult(isolate, AddonData::From(args), retRational));
+}
+
+void addon::WrappedRational::ToFixed(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+
+	if(args.Length() > 2){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	/* Undefined arguments taken as omitted, as by default parameters. */
+	long digits = 0;
+	if(args.Length() > 0 && !args[0]->IsUndefined() && !toIntegral(isolate, args[0], digits)) return;
+
+	if(digits < 0 || digits > maxFixedDigits){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
+
+	src::rounding mode = src::rounding::half_even;
+	if(args.Length() == 2 && !args[1]->IsUndefined() && !toRounding(isolate, args[1], mode)) return;
+
+	/* A sign, the integer part with a carry into a new digit, the point and the fraction digits. */
+	char buf[std::numeric_limits<long>::digits10 + maxFixedDigits + 5];
+	const std::to_chars_result res = src::to_decimal(buf, buf + sizeof(buf), ptrWrappedRational->value, static_cast<int>(digits), mode);
+
+	Local<String> retval = String::NewFromUtf8(isolate, buf, NewStringType::kNormal, static_cast<int>(res.ptr - buf)).ToLocalChecked();
+
+	args.GetReturnValue().Set(retval);
+}
+
+void addon::WrappedRational::ToDecimalString(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+	Local<Context> context = isolate->GetCurrentContext();
+
+	WrappedRational *ptrWrappedRational = ObjectWrap::Unwrap<WrappedRational>(args.Holder());
+
+	if(args.Length() > 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	/* An undefined options object or option taken as omitted, as by default parameters. */
+	long digits = defaultExpansionDigits;
+	bool repeat = true;
+
+	if(args.Length() == 1 && !args[0]->IsUndefined()){
+		if(!args[0]->IsObject()){
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return;
+		}
+
+		Local<Object> options = args[0].As<Object>();
+
+		Local<Value> maxDigits, repeatOption;
+
+		if(!options->Get(context, String::NewFromUtf8(isolate, "maxDigits").ToLocalChecked()).ToLocal(&maxDigits)) return;
+		if(!options->Get(context, String::NewFromUtf8(isolate, "repeat").ToLocalChecked()).ToLocal(&repeatOption)) return;
+
+		if(!maxDigits->IsUndefined() && !toIntegral(isolate, maxDigits, digits)) return;
 
-	ss.tie( NULL );
-	ss.exceptions( std::ios::goodbit );
-	ss.width( 0 );
-	ss << std::noshowpos << std::noshowbase << '/' << ptrWrappedRational->ptrRational->denominator();
+		if(!repeatOption->IsUndefined() && !repeatOption->IsBoolean()){
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return;
+		}
+
+		if(repeatOption->IsBoolean()) repeat = repeatOption->IsTrue();
+	}
 
-	const std::string tail = ss.str();
-	std::streamsize const w =
-		ss.width() - static_cast<std::streamsize>( tail.size() );
+	if(digits < 0 || digits > maxExpansionDigits){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
 
-	ss.clear();
-	ss.str( "" );
-	ss << std::setw( w < 0 || (ss.flags() & std::ios::adjustfield) !=
-					 std::ios::internal ? 0 : w ) << ptrWrappedRational->ptrRational->numerator();
+	/* A sign, the integer part, the point, the fraction digits and the parentheses or the ellipsis. */
+	char buf[std::numeric_limits<long>::digits10 + maxExpansionDigits + 7];
+	const std::to_chars_result res = src::to_decimal_expansion(buf, buf + sizeof(buf), ptrWrappedRational->value, static_cast<int>(digits), repeat);
 
-	std::string s = ss.str() + tail;
-	Local<String> retval = String::NewFromUtf8(isolate, s.c_str()).ToLocalChecked();
+	Local<String> retval = String::NewFromUtf8(isolate, buf, NewStringType::kNormal, static_cast<int>(res.ptr - buf)).ToLocalChecked();
 
 	args.GetReturnValue().Set(retval);
 }
@@ -2216,10 +2138,52 @@ void addon::WrappedRational::GetField(Local<String> property, const PropertyCall
 	std::string str(*s, s.length());
 
 	if(str == "num"){
-		info.GetReturnValue().Set(Number::New(isolate, ptrWrappedRational->ptrRational->numerator()));
+		info.GetReturnValue().Set(Number::New(isolate, ptrWrappedRational->value.numerator()));
 	}
 	else
 	if(str == "den"){
-		info.GetReturnValue().Set(Number::New(isolate, ptrWrappedRational->ptrRational->denominator()));
+		info.GetReturnValue().Set(Number::New(isolate, ptrWrappedRational->value.denominator()));
+	}
+}
+
+#ifdef RATIONAL_FAST_API
+/* Fast API overloads [6] */
+double addon::WrappedRational::FastGetNumerator(Local<Value> receiver){
+	return ObjectWrap::Unwrap<WrappedRational>(receiver.As<Object>())->value.numerator();
+}
+
+double addon::WrappedRational::FastGetDenominator(Local<Value> receiver){
+	return ObjectWrap::Unwrap<WrappedRational>(receiver.As<Object>())->value.denominator();
+}
+
+bool addon::WrappedRational::FastLessThan(Local<Value> receiver, double value, v8::FastApiCallbackOptions& options){
+	if(!isInteger(value)){
+		options.fallback = true;
+		return false;
+	}
+
+	return ObjectWrap::Unwrap<WrappedRational>(receiver.As<Object>())->value < static_cast<long>(value);
+}
+
+bool addon::WrappedRational::FastGreaterThan(Local<Value> receiver, double value, v8::FastApiCallbackOptions& options){
+	if(!isInteger(value)){
+		options.fallback = true;
+		return false;
+	}
+
+	return ObjectWrap::Unwrap<WrappedRational>(receiver.As<Object>())->value > static_cast<long>(value);
+}
+
+bool addon::WrappedRational::FastEqualTo(Local<Value> receiver, double value, v8::FastApiCallbackOptions& options){
+	if(!isInteger(value)){
+		options.fallback = true;
+		return false;
 	}
+
+	return ObjectWrap::Unwrap<WrappedRational>(receiver.As<Object>())->value == static_cast<long>(value);
+}
+
+double addon::WrappedRational::FastValueOf(Local<Value> receiver){
+	return src::rational_cast<double, long>(ObjectWrap::Unwrap<WrappedRational>(receiver.As<Object>())->value);
 }
+#endif
@@ -7,11 +7,32 @@
 #ifndef __RATIONAL_ADDON_H__
 #define __RATIONAL_ADDON_H__
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 #include <node.h>
 #include <node_object_wrap.h>
+#include <uv.h>
+
+/*
+ * The V8 fast API, not among the headers Node.js 20 installs for addons, but present
+ * when building against a Node.js source tree with '--nodedir'. Without it, the
+ * methods are registered with their regular callbacks only.
+ */
+#if defined(__has_include)
+#if __has_include(<v8-fast-api-calls.h>)
+#include <v8-fast-api-calls.h>
+#define RATIONAL_FAST_API
+#endif
+#endif
 
 #include "../include/rational.h"
 
+namespace src{
+	class bigint;
+}
+
 /**
  * namespace addon
  */
@@ -19,15 +40,157 @@ namespace addon{
 
 	using v8::FunctionCallbackInfo;
 	using v8::PropertyCallbackInfo;
+	using v8::Isolate;
+	using v8::Exception;
 	using v8::Local;
 	using v8::Value;
 	using v8::Object;
 	using v8::String;
 	using v8::Persistent;
 	using v8::Function;
+	using v8::FunctionTemplate;
+	using v8::External;
 
 	using src::rational;
 
+	/**
+	 * Throws an exception
+	 */
+	inline void throwException(Isolate *isolate, Local<Value>(*func)(Local<String>), const char* msg){
+		isolate->ThrowException(
+			func(String::NewFromUtf8(isolate, msg).ToLocalChecked())
+		);
+	}
+
+	/**
+	 * The JavaScript message of the given bad_rational, its "bad rational: <cause>"
+	 * read as "Rational: bad rational, <cause>".
+	 */
+	inline std::string badRationalMessage(const src::bad_rational& e){
+		const std::string what = e.what();
+		const std::string prefix = "bad rational: ";
+
+		if(what.compare(0, prefix.size(), prefix) == 0)
+			return "Rational: bad rational, " + what.substr(prefix.size());
+
+		return "Rational: " + what;
+	}
+
+	/**
+	 * Invokes the given callback, translating the exceptions thrown by the
+	 * rational template class into JavaScript exceptions.
+	 */
+	template<void (*F)(const FunctionCallbackInfo<Value>&)>
+	void guarded(const FunctionCallbackInfo<Value>& args){
+		try{
+			F(args);
+		}
+		catch(src::rational_overflow&){
+			throwException(args.GetIsolate(), Exception::RangeError, "Rational: arithmetic overflow");
+		}
+		catch(src::bad_rational& e){
+			throwException(args.GetIsolate(), Exception::TypeError, badRationalMessage(e).c_str());
+		}
+	}
+
+	/** Whether the given double is an integer held exactly by a long. */
+	bool isInteger(double);
+
+	/**
+	 * Converts a JavaScript number or BigInt into an integer, throwing a JavaScript
+	 * exception and returning false if it is neither or out of range.
+	 */
+	bool toInteger(Isolate*, Local<Value>, long&);
+
+	/**
+	 * Converts a JavaScript number or BigInt into an integer as toInteger does, throwing
+	 * a TypeError for a fractional number instead of truncating it.
+	 */
+	bool toIntegral(Isolate*, Local<Value>, long&);
+
+	/**
+	 * Converts a JavaScript number, taken as the exact value of the double, or BigInt into a
+	 * rational, throwing a JavaScript exception and returning false if it is neither or out of range.
+	 */
+	bool toExact(Isolate*, Local<Value>, rational<long>&);
+
+	/**
+	 * Parses the "n/d" or "n" form given by toString() as a whole, the one parser of string
+	 * arguments, throwing rational_overflow for terms out of range, bad_rational for a zero
+	 * denominator and std::invalid_argument otherwise.
+	 */
+	rational<long> parseRational(const char*, const char*);
+
+	/**
+	 * Converts a JavaScript string by parseRational(), throwing a JavaScript exception and
+	 * returning false if it is not a rational.
+	 */
+	bool toParsed(Isolate*, Local<Value>, rational<long>&);
+
+	/**
+	 * Converts a JavaScript number, BigInt or string term of a quotient, as toExact()
+	 * and toParsed() do.
+	 */
+	bool toTerm(Isolate*, Local<Value>, rational<long>&);
+
+	/** Whether the given value is a number, BigInt or string term of a quotient. */
+	bool isTerm(Local<Value>);
+
+	/**
+	 * Converts a JavaScript Rational, number, BigInt or numeric string into a rational,
+	 * throwing a JavaScript exception and returning false if it is none of them.
+	 */
+	bool toRational(Isolate*, Local<Value>, rational<long>&);
+
+	/**
+	 * Copies the rationals held as numerators and denominators in typed arrays of a kind the
+	 * batch methods take, throwing a JavaScript exception and returning false if they are not.
+	 */
+	bool toRationals(Isolate*, Local<Value>, Local<Value>, std::vector< rational<long> >&);
+
+	/**
+	 * The state of the addon in a single Node.js environment, the main thread or a
+	 * worker, handed to every function it creates as the data of their callbacks.
+	 */
+	struct AddonData{
+		Persistent<Function> rationalConstructor;
+		Persistent<FunctionTemplate> rationalTemplate;
+		Persistent<Function> accumulatorConstructor;
+		Persistent<Function> bigRationalConstructor;
+		Persistent<FunctionTemplate> bigRationalTemplate;
+
+		std::vector< v8::Global<Object> > constants;  /**< Frozen constants of the 'Rational' function. */
+		std::vector< v8::Global<Object> > cache;      /**< Frozen small rationals, created on demand. */
+		long cacheBound = 0;                          /**< Largest |numerator| and denominator cached, 0 if none. */
+
+		std::size_t pending = 0;  /**< Asynchronous jobs not yet settled. */
+		bool closing = false;     /**< The environment is being torn down. */
+
+		node::AsyncCleanupHookHandle hook;
+		void (*done)(void*) = nullptr;  /**< Ends the cleanup of the environment, with its argument. */
+		void *doneArg = nullptr;
+
+		/** The state of the environment the given callback belongs to. */
+		static AddonData* From(const FunctionCallbackInfo<Value>& args){
+			return static_cast<AddonData*>(args.Data().As<External>()->Value());
+		}
+
+		/**
+		 * Asynchronous environment cleanup hook, keeping the event loop of the environment
+		 * running until the pending jobs are done, none of which settles its promise.
+		 */
+		static void Cleanup(void*, void (*)(void*), void*);
+
+		/** Deletes the state, ending the cleanup of the environment. */
+		void Release();
+	};
+
+	/**
+	 * Adds a method to the prototype as NODE_SET_PROTOTYPE_METHOD does, passing the given
+	 * data to the callback, with an optional fast API overload TurboFan may call instead.
+	 */
+	void setPrototypeMethod(Local<FunctionTemplate>, const char*, v8::FunctionCallback, Local<Value>, const v8::CFunction* = nullptr);
+
 	/**
 	 * A class that extends the base class ObjectWrap provided by Node.js and
 	 * can be instantiated from JavaScript using the new operator.
@@ -38,27 +201,81 @@ namespace addon{
 			 * A static function responsible for adding all class functions
 			 * calleable from JavaScript code to the exports object.
 			 */
-			static void Init(Local<Object>);
+			static void Init(Local<Object>, AddonData*);
+
+			/**
+			 * Returns the wrapped object of a JavaScript Rational, or nullptr if the value
+			 * is not an object constructed by a 'Rational' function of any environment.
+			 */
+			static WrappedRational* FromValue(Isolate*, Local<Value>);
+
+			/**
+			 * Returns a new JavaScript Rational wrapping the given normalized value,
+			 * instantiated from the object template without calling 'New'.
+			 */
+			static Local<Object> NewInstance(Isolate*, const AddonData*, const rational<long>&);
+
+			/**
+			 * Returns a new frozen JavaScript Rational wrapping the given normalized value,
+			 * which its methods refuse to change.
+			 */
+			static Local<Object> NewFrozen(Isolate*, const AddonData*, const rational<long>&);
+
+			/**
+			 * Returns the JavaScript Rational of a non-mutating result, the shared frozen one
+			 * when within the bound of the small-rational cache, a new one otherwise.
+			 */
+			static Local<Object> NewResult(Isolate*, AddonData*, const rational<long>&);
+
+			/**
+			 * Returns the wrapped object of a JavaScript Rational about to be changed, or nullptr
+			 * with a pending JavaScript exception if it is frozen.
+			 */
+			static WrappedRational* Mutable(Isolate*, Local<Object>);
 		private:
-			rational<long> *ptrRational;
+			friend class WrappedAccumulator;
+			friend bool toBigRational(Isolate*, Local<Value>, rational<src::bigint>&);
+			friend bool toRational(Isolate*, Local<Value>, rational<long>&);
+
+			/** The value, held inline so each object is a single native allocation. */
+			rational<long> value;
+
+			/** Whether the value is shared, as that of a constant or a cached result. */
+			bool frozen = false;
 
 			/** Default constructor */
-			explicit WrappedRational()
-				: ptrRational(new rational<long>()){}
+			explicit WrappedRational(){}
 
 			/** One argument constructor */
 			explicit WrappedRational(const long& n)
-				: ptrRational(new rational<long>(n)){}
+				: value(n){}
 
 			/** Two arguments constructor */
 			explicit WrappedRational(const long& n, const long& d)
-				: ptrRational(new rational<long>(n, d)){}
+				: value(n, d){}
+
+			/** Copy of a normalized value */
+			explicit WrappedRational(const rational<long>& r)
+				: value(r){}
 
+			/** Releases the native size reported to V8 by Attach, unless the isolate is being torn down. */
 			~WrappedRational(){
-				delete ptrRational;
+				if(Isolate *isolate = Isolate::GetCurrent())
+					isolate->AdjustAmountOfExternalAllocatedMemory(-static_cast<int64_t>(sizeof(WrappedRational)));
+			}
+
+			/** Wraps and brands the given object, reporting the native size to V8 as external memory. */
+			void Attach(Isolate *isolate, Local<Object> object){
+				Wrap(object);
+				object->SetAlignedPointerInInternalField(1, const_cast<int*>(&brand));
+				isolate->AdjustAmountOfExternalAllocatedMemory(sizeof(WrappedRational));
 			}
 
-			static Persistent<Function> constructor;
+			/**
+			 * The address stored in the second internal field of every Rational object, a brand
+			 * shared by all environments, unlike their function templates.
+			 */
+			static const int brand;
 
 			/**
 			 * A static function associated with the JavaScript function 'Rational'
@@ -94,6 +311,12 @@ namespace addon{
 			static void Neg (const FunctionCallbackInfo<Value>&);
 			static void Abs (const FunctionCallbackInfo<Value>&);
 
+			static void LimitDenominator(const FunctionCallbackInfo<Value>&);
+
+			static void Floor(const FunctionCallbackInfo<Value>&);
+			static void Ceil (const FunctionCallbackInfo<Value>&);
+			static void Round(const FunctionCallbackInfo<Value>&);
+
 			static void Not (const FunctionCallbackInfo<Value>&);
 			static void Bool(const FunctionCallbackInfo<Value>&);
 
@@ -104,17 +327,83 @@ namespace addon{
 
 			static void ValueOf(const FunctionCallbackInfo<Value>&);
 			static void ToString(const FunctionCallbackInfo<Value>&);
+			static void ToFixed (const FunctionCallbackInfo<Value>&);
+			static void ToDecimalString(const FunctionCallbackInfo<Value>&);
+
+			/**
+			 * A static function setting the bound of the small-rational cache, 0 to disable it.
+			 */
+			static void SetCache(const FunctionCallbackInfo<Value>&);
+
+			/**
+			 * A static function converting a number exactly, or to the closest rational with a
+			 * denominator up to the given bound.
+			 */
+			static void FromNumber(const FunctionCallbackInfo<Value>&);
+
+			/**
+			 * Static functions writing the result of an operation on their leading arguments into
+			 * the Rational object given last, creating no objects, and returning it.
+			 */
+			static void AddInto(const FunctionCallbackInfo<Value>&);
+			static void SubInto(const FunctionCallbackInfo<Value>&);
+			static void MulInto(const FunctionCallbackInfo<Value>&);
+			static void DivInto(const FunctionCallbackInfo<Value>&);
+			static void PowInto(const FunctionCallbackInfo<Value>&);
+			static void NegInto(const FunctionCallbackInfo<Value>&);
+			static void AbsInto(const FunctionCallbackInfo<Value>&);
+
+			/**
+			 * Static functions reducing an array of rationals, or the rationals held in typed
+			 * arrays, on the libuv threadpool one chunk per work request.
+			 */
+			static void ReduceAsync(const FunctionCallbackInfo<Value>&);
+			static void SumAsync(const FunctionCallbackInfo<Value>&);
+
+			/**
+			 * Static functions sorting an array of rationals or parsing an array of strings
+			 * on the libuv threadpool as a single work request, copying their inputs first.
+			 */
+			static void SortAsync(const FunctionCallbackInfo<Value>&);
+			static void ParseAsync(const FunctionCallbackInfo<Value>&);
+
+			/**
+			 * Static functions applying an operation elementwise to rationals held as numerators
+			 * and denominators in typed arrays, storing the results in place without allocating.
+			 */
+			static void AddArrays(const FunctionCallbackInfo<Value>&);
+			static void SubArrays(const FunctionCallbackInfo<Value>&);
+			static void MulArrays(const FunctionCallbackInfo<Value>&);
+			static void DivArrays(const FunctionCallbackInfo<Value>&);
+			static void CompareArrays(const FunctionCallbackInfo<Value>&);
 
 			static void GetField(Local<String>, const PropertyCallbackInfo<Value>&);
+
+#ifdef RATIONAL_FAST_API
+			/**
+			 * Fast API overloads called by optimized code instead of the callbacks above,
+			 * falling back to them for the arguments that throw.
+			 */
+			static double FastGetNumerator(Local<Value>);
+			static double FastGetDenominator(Local<Value>);
+
+			static bool FastLessThan(Local<Value>, double, v8::FastApiCallbackOptions&);
+			static bool FastGreaterThan(Local<Value>, double, v8::FastApiCallbackOptions&);
+			static bool FastEqualTo(Local<Value>, double, v8::FastApiCallbackOptions&);
+
+			static double FastValueOf(Local<Value>);
+#endif
 	};
 
 	/**
-	 * C++ function that will be called from JavaScript when the module is required.
+	 * C++ function that will be called from JavaScript when the module is required,
+	 * once in every environment requiring it.
 	 *
 	 * @param exports The JavaScript module.exports object.
 	 * @param module  The JavaScript module object.
+	 * @param context The context of the environment.
 	 */
-	void Init(Local<Object>, Local<Value>, void*);
+	void Init(Local<Object>, Local<Value>, Local<v8::Context>, void*);
 }
 
 #endif
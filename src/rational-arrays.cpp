@@ -0,0 +1,271 @@
+/**
+ * @file    rational-arrays.cpp
+ * @version v1.0.0
+ * @author  Essam A. El-Sherif
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "../include/rational_vector.h"
+#include "rational-addon.h"
+
+namespace addon{
+
+	using v8::TypedArray;
+
+	/**
+	 * Elementwise operations of the batch methods.
+	 */
+	enum class batch{ add, sub, mul, div, compare };
+
+	/** The largest integer of a Float64Array stored exactly along with all smaller ones. */
+	const double maxSafeInteger = 9007199254740991.0;
+
+	/** The elements of a typed array, in place in its buffer. */
+	template<typename T>
+	T* elements(Local<Value> value){
+		Local<TypedArray> array = value.As<TypedArray>();
+		return reinterpret_cast<T*>(static_cast<char*>(array->Buffer()->Data()) + array->ByteOffset());
+	}
+
+	/** Whether the given typed arrays have the same element type, one of those taken by the batch methods. */
+	bool sameKind(Local<Value> a, Local<Value> b){
+		return (a->IsInt32Array() && b->IsInt32Array())
+			|| (a->IsBigInt64Array() && b->IsBigInt64Array())
+			|| (a->IsFloat64Array() && b->IsFloat64Array());
+	}
+
+	/** Whether the given element is an integer of the type the batch methods compute in. */
+	template<typename T>
+	bool isInteger(T){
+		return true;
+	}
+
+	/**
+	 * Checks the operands to be integers with positive denominators, and the divisors to be non-zero,
+	 * throwing a JavaScript exception and returning false otherwise.
+	 */
+	template<typename T>
+	bool batchCheck(Isolate *isolate, batch op, const T* an, const T* ad, const T* bn, const T* bd, std::size_t n){
+		for(std::size_t i = 0; i < n; i++){
+			if(!isInteger(an[i]) || !isInteger(ad[i]) || !isInteger(bn[i]) || !isInteger(bd[i]) || ad[i] < 0 || bd[i] < 0){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+
+			if(ad[i] == 0 || bd[i] == 0){
+				throwException(isolate, Exception::TypeError, "Rational: bad rational, zero denominator");
+				return false;
+			}
+
+			if(op == batch::div && bn[i] == 0){
+				throwException(isolate, Exception::TypeError, "Rational: division by zero");
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** Applies the operation to arrays of integers in place, by the kernels of rational_vector. */
+	template<typename I>
+	void batchApply(batch op, const I* an, const I* ad, const I* bn, const I* bd, I* rn, I* rd, int* c, std::size_t n){
+		switch(op){
+			case batch::add:     src::rational_vector<I>::add(an, ad, bn, bd, rn, rd, n); break;
+			case batch::sub:     src::rational_vector<I>::sub(an, ad, bn, bd, rn, rd, n); break;
+			case batch::mul:     src::rational_vector<I>::mul(an, ad, bn, bd, rn, rd, n); break;
+			case batch::div:     src::rational_vector<I>::div(an, ad, bn, bd, rn, rd, n); break;
+			case batch::compare: src::rational_vector<I>::compare(an, ad, bn, bd, c, n); break;
+		}
+	}
+
+	/**
+	 * Applies the operation to arrays of integral doubles, converted to long a block at a time,
+	 * throwing rational_overflow for results a double does not hold exactly.
+	 */
+	void batchApply(batch op, const double* an, const double* ad, const double* bn, const double* bd, double* rn, double* rd, int* c, std::size_t n){
+		const std::size_t block = 256;
+
+		long xn[block], xd[block], yn[block], yd[block], zn[block], zd[block];
+
+		for(std::size_t k = 0; k < n; k += block){
+			const std::size_t m = n - k < block ? n - k : block;
+
+			for(std::size_t i = 0; i < m; i++){
+				xn[i] = static_cast<long>(an[k + i]);
+				xd[i] = static_cast<long>(ad[k + i]);
+				yn[i] = static_cast<long>(bn[k + i]);
+				yd[i] = static_cast<long>(bd[k + i]);
+			}
+
+			batchApply<long>(op, xn, xd, yn, yd, zn, zd, c ? c + k : nullptr, m);
+
+			if(op == batch::compare) continue;
+
+			for(std::size_t i = 0; i < m; i++){
+				if(zn[i] > maxSafeInteger || zn[i] < -maxSafeInteger || zd[i] > maxSafeInteger)
+					throw src::rational_overflow();
+
+				rn[k + i] = static_cast<double>(zn[i]);
+				rd[k + i] = static_cast<double>(zd[i]);
+			}
+		}
+	}
+
+	/** Operands of 64-bit and double elements, normalized by the scalar rational operators. */
+	template<typename T>
+	void normalize(const T*&, const T*&, std::vector<T>&, std::vector<T>&, std::size_t){}
+
+	/**
+	 * Points the terms of an Int32Array operand to a copy in lowest terms unless they already are,
+	 * the widened kernels of 32-bit integers cancelling only the factors common to both operands.
+	 */
+	void normalize(const int32_t*& num, const int32_t*& den, std::vector<int32_t>& rn, std::vector<int32_t>& rd, std::size_t n){
+		std::size_t i = 0;
+		while(i < n && src::binary_gcd(num[i], den[i]) == 1) i++;
+
+		if(i == n) return;
+
+		rn.assign(num, num + n);
+		rd.assign(den, den + n);
+
+		for( ; i < n; i++){
+			const int32_t g = src::binary_gcd(rn[i], rd[i]);
+
+			rn[i] /= g;
+			rd[i] /= g;
+		}
+
+		num = rn.data();
+		den = rd.data();
+	}
+
+	/** Checks the operands and applies the operation to typed arrays of the given element type. */
+	template<typename T>
+	void batchTyped(Isolate *isolate, const FunctionCallbackInfo<Value>& args, batch op, std::size_t n){
+		const T *an = elements<T>(args[0]), *ad = elements<T>(args[1]);
+		const T *bn = elements<T>(args[2]), *bd = elements<T>(args[3]);
+
+		if(!batchCheck(isolate, op, an, ad, bn, bd, n)) return;
+
+		/* Copies of operands not in lowest terms, read before the results are stored. */
+		std::vector<T> xn, xd, yn, yd;
+
+		if(op != batch::compare){
+			normalize(an, ad, xn, xd, n);
+			normalize(bn, bd, yn, yd, n);
+		}
+
+		if(op == batch::compare)
+			batchApply(op, an, ad, bn, bd, static_cast<T*>(nullptr), static_cast<T*>(nullptr), elements<int32_t>(args[4]), n);
+		else
+			batchApply(op, an, ad, bn, bd, elements<T>(args[4]), elements<T>(args[5]), static_cast<int*>(nullptr), n);
+	}
+
+	/**
+	 * The batch methods: numerators and denominators of both operands, then those of the
+	 * results or an Int32Array of comparisons, all of the same length.
+	 */
+	void batchArrays(const FunctionCallbackInfo<Value>& args, batch op){
+
+		/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+		Isolate *isolate = args.GetIsolate();
+
+		const int argc = op == batch::compare ? 5 : 6;
+
+		if(args.Length() != argc){
+			throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+			return;
+		}
+
+		for(int i = 0; i < argc; i++){
+			if(!args[i]->IsTypedArray() || args[i].As<TypedArray>()->Length() != args[0].As<TypedArray>()->Length()){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return;
+			}
+		}
+
+		for(int i = 1; i < argc; i++){
+			const bool valid = op == batch::compare && i == 4 ? args[i]->IsInt32Array() : sameKind(args[0], args[i]);
+
+			if(!valid){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return;
+			}
+		}
+
+		const std::size_t n = args[0].As<TypedArray>()->Length();
+
+		if(args[0]->IsInt32Array())
+			batchTyped<int32_t>(isolate, args, op, n);
+		else
+		if(args[0]->IsBigInt64Array())
+			batchTyped<int64_t>(isolate, args, op, n);
+		else
+		if(args[0]->IsFloat64Array())
+			batchTyped<double>(isolate, args, op, n);
+		else
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+	}
+}
+
+bool addon::toRationals(Isolate *isolate, Local<Value> num, Local<Value> den, std::vector< rational<long> >& values){
+	if(!num->IsTypedArray() || !sameKind(num, den) || num.As<TypedArray>()->Length() != den.As<TypedArray>()->Length()){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return false;
+	}
+
+	const std::size_t n = num.As<TypedArray>()->Length();
+
+	values.resize(n);
+
+	if(num->IsInt32Array()){
+		const int32_t *pn = elements<int32_t>(num), *pd = elements<int32_t>(den);
+
+		for(std::size_t i = 0; i < n; i++)
+			values[i] = rational<long>(pn[i], pd[i]);
+	}
+	else
+	if(num->IsBigInt64Array()){
+		const int64_t *pn = elements<int64_t>(num), *pd = elements<int64_t>(den);
+
+		for(std::size_t i = 0; i < n; i++)
+			values[i] = rational<long>(pn[i], pd[i]);
+	}
+	else{
+		const double *pn = elements<double>(num), *pd = elements<double>(den);
+
+		for(std::size_t i = 0; i < n; i++){
+			if(!isInteger(pn[i]) || !isInteger(pd[i])){
+				throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+				return false;
+			}
+
+			values[i] = rational<long>(static_cast<long>(pn[i]), static_cast<long>(pd[i]));
+		}
+	}
+
+	return true;
+}
+
+void addon::WrappedRational::AddArrays(const FunctionCallbackInfo<Value>& args){
+	batchArrays(args, batch::add);
+}
+
+void addon::WrappedRational::SubArrays(const FunctionCallbackInfo<Value>& args){
+	batchArrays(args, batch::sub);
+}
+
+void addon::WrappedRational::MulArrays(const FunctionCallbackInfo<Value>& args){
+	batchArrays(args, batch::mul);
+}
+
+void addon::WrappedRational::DivArrays(const FunctionCallbackInfo<Value>& args){
+	batchArrays(args, batch::div);
+}
+
+void addon::WrappedRational::CompareArrays(const FunctionCallbackInfo<Value>& args){
+	batchArrays(args, batch::compare);
+}
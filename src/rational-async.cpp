@@ -0,0 +1,428 @@
+/**
+ * @file    rational-async.cpp
+ * @version v1.0.0
+ * @author  Essam A. El-Sherif
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/rational_parallel.h"
+#include "rational-addon.h"
+
+namespace addon{
+
+	using v8::Array;
+	using v8::Context;
+	using v8::HandleScope;
+	using v8::Promise;
+
+	/**
+	 * The state shared by the asynchronous jobs, settling a promise once done.
+	 */
+	struct AsyncJob{
+		Isolate *isolate;
+		AddonData *data;
+		Persistent<Context> context;
+		Persistent<Promise::Resolver> resolver;
+		Persistent<Object> resource;
+		node::async_context async;
+	};
+
+	/**
+	 * The state of a reduction running on the libuv threadpool.
+	 */
+	struct ReduceJob : AsyncJob{
+		/** A work request reducing a single chunk. */
+		struct Chunk{
+			uv_work_t request;
+			ReduceJob *job;
+			std::size_t index;
+		};
+
+		std::vector< rational<long> > values;
+		src::reduction op;
+
+		std::vector< rational<long> > partial;      /**< Partial result of each chunk. */
+		std::vector<std::exception_ptr> errors;     /**< Exception of each chunk, if any. */
+		std::vector<Chunk> chunks;
+		std::size_t remaining;                      /**< Chunks not yet done. */
+	};
+
+	/**
+	 * The state of a sort or a parse running on the libuv threadpool as a single work request.
+	 */
+	struct BatchJob : AsyncJob{
+		uv_work_t request;
+
+		std::vector< rational<long> > values;       /**< Values to sort, or the parsed values. */
+		std::vector<std::string> strings;           /**< Strings to parse, if any. */
+		std::exception_ptr error;
+	};
+
+	/**
+	 * Starts tracking the given job, returning the promise it settles once done.
+	 */
+	Local<Promise> asyncBegin(AsyncJob *job, Isolate *isolate, AddonData *data, const char* name){
+		Local<Context> context = isolate->GetCurrentContext();
+
+		Local<Promise::Resolver> resolver = Promise::Resolver::New(context).ToLocalChecked();
+		Local<Object> resource = Object::New(isolate);
+
+		job->isolate = isolate;
+		job->data = data;
+		job->data->pending++;
+		job->context.Reset(isolate, context);
+		job->resolver.Reset(isolate, resolver);
+		job->resource.Reset(isolate, resource);
+		job->async = node::EmitAsyncInit(isolate, resource, name);
+
+		return resolver->GetPromise();
+	}
+
+	/**
+	 * Settles the promise of a job done with the value its given function returns, or with the
+	 * exception it throws, then deletes the job.
+	 */
+	template<typename J, typename F>
+	void asyncEnd(J *job, F settle){
+		AddonData *data = job->data;
+		data->pending--;
+
+		/* Done while its environment is torn down, with no JavaScript left to run. */
+		if(data->closing){
+			delete job;
+			if(!data->pending) data->Release();
+			return;
+		}
+
+		Isolate *isolate = job->isolate;
+		HandleScope scope(isolate);
+
+		Local<Context> context = job->context.Get(isolate);
+		Context::Scope contextScope(context);
+
+		/* A stopping worker runs no more JavaScript, leaving the promise pending. */
+		if(!isolate->IsExecutionTerminating()){
+			/* Runs the microtasks of the settled promise when leaving the scope. */
+			node::CallbackScope callbackScope(isolate, job->resource.Get(isolate), job->async);
+
+			Local<Promise::Resolver> resolver = job->resolver.Get(isolate);
+			Local<Value> reason;
+
+			try{
+				resolver->Resolve(context, settle(isolate, data)).Check();
+			}
+			catch(src::rational_overflow&){
+				reason = Exception::RangeError(String::NewFromUtf8(isolate, "Rational: arithmetic overflow").ToLocalChecked());
+			}
+			catch(src::bad_rational& e){
+				reason = Exception::TypeError(String::NewFromUtf8(isolate, badRationalMessage(e).c_str()).ToLocalChecked());
+			}
+			catch(std::invalid_argument&){
+				reason = Exception::TypeError(String::NewFromUtf8(isolate, "Rational: invalid argument").ToLocalChecked());
+			}
+
+			if(!reason.IsEmpty())
+				resolver->Reject(context, reason).Check();
+		}
+
+		node::EmitAsyncDestroy(isolate, job->async);
+
+		job->context.Reset();
+		job->resolver.Reset();
+		job->resource.Reset();
+
+		delete job;
+	}
+
+	/**
+	 * Returns a new JavaScript array of Rational objects of the given values.
+	 */
+	Local<Array> newArray(Isolate *isolate, const AddonData *data, const std::vector< rational<long> >& values){
+		Local<Context> context = isolate->GetCurrentContext();
+		Local<Array> array = Array::New(isolate, static_cast<int>(values.size()));
+
+		for(std::size_t i = 0; i < values.size(); i++)
+			array->Set(context, static_cast<uint32_t>(i), WrappedRational::NewInstance(isolate, data, values[i])).Check();
+
+		return array;
+	}
+
+	/** Reduces a single chunk of a reduction on a threadpool thread. */
+	void reduceWork(uv_work_t *request){
+		ReduceJob::Chunk *chunk = static_cast<ReduceJob::Chunk*>(request->data);
+		ReduceJob *job = chunk->job;
+
+		const std::size_t begin = chunk->index * src::reduce_chunk;
+		const std::size_t count = job->values.size() - begin < src::reduce_chunk ? job->values.size() - begin : src::reduce_chunk;
+
+		try{
+			job->partial[chunk->index] = src::reduce_sequential(job->values.data() + begin, count, job->op);
+		}
+		catch(...){
+			job->errors[chunk->index] = std::current_exception();
+		}
+	}
+
+	/** Combines the partial results once the last chunk of a reduction is done. */
+	void reduceDone(uv_work_t *request, int){
+		ReduceJob *job = static_cast<ReduceJob::Chunk*>(request->data)->job;
+
+		if(--job->remaining > 0) return;
+
+		asyncEnd(job, [job](Isolate *isolate, AddonData *data) -> Local<Value> {
+			/* The first failed chunk, not the first to fail, for results independent of scheduling. */
+			for(std::exception_ptr& e : job->errors)
+				if(e) std::rethrow_exception(e);
+
+			return WrappedRational::NewInstance(isolate, data, src::reduce_tree(job->partial, job->op));
+		});
+	}
+
+	/** Sorts the values of a job, or parses its strings, on a threadpool thread. */
+	void batchWork(uv_work_t *request){
+		BatchJob *job = static_cast<BatchJob*>(request->data);
+
+		try{
+			if(job->strings.empty()){
+				std::sort(job->values.begin(), job->values.end());
+				return;
+			}
+
+			job->values.resize(job->strings.size());
+
+			/* The one parser of string arguments, free of V8 and so safe off the main thread. */
+			for(std::size_t i = 0; i < job->strings.size(); i++){
+				const char *first = job->strings[i].data();
+				job->values[i] = parseRational(first, first + job->strings[i].size());
+			}
+		}
+		catch(...){
+			job->error = std::current_exception();
+		}
+	}
+
+	/** Settles the promise of a sort or a parse with a new array of Rational objects. */
+	void batchDone(uv_work_t *request, int){
+		BatchJob *job = static_cast<BatchJob*>(request->data);
+
+		asyncEnd(job, [job](Isolate *isolate, AddonData *data) -> Local<Value> {
+			if(job->error) std::rethrow_exception(job->error);
+
+			return newArray(isolate, data, job->values);
+		});
+	}
+
+	/**
+	 * Starts a reduction of the given values, one work request per chunk, returning its promise.
+	 */
+	Local<Promise> reduceBegin(const FunctionCallbackInfo<Value>& args, std::vector< rational<long> >& values, src::reduction op, const char* name){
+		ReduceJob *job = new ReduceJob();
+
+		Local<Promise> promise = asyncBegin(job, args.GetIsolate(), AddonData::From(args), name);
+
+		job->values.swap(values);
+		job->op = op;
+
+		const std::size_t chunks = (job->values.size() + src::reduce_chunk - 1) / src::reduce_chunk;
+
+		job->partial.resize(chunks);
+		job->errors.resize(chunks);
+		job->chunks.resize(chunks);
+		job->remaining = chunks;
+
+		for(std::size_t i = 0; i < chunks; i++){
+			ReduceJob::Chunk& chunk = job->chunks[i];
+
+			chunk.job = job;
+			chunk.index = i;
+			chunk.request.data = &chunk;
+
+			uv_queue_work(node::GetCurrentEventLoop(args.GetIsolate()), &chunk.request, reduceWork, reduceDone);
+		}
+
+		return promise;
+	}
+
+	/**
+	 * Copies the elements of a JavaScript array into rationals, returning false with a
+	 * pending JavaScript exception if one of them is not a rational.
+	 */
+	bool toRationals(Isolate *isolate, Local<Value> arg, std::vector< rational<long> >& values){
+		Local<Context> context = isolate->GetCurrentContext();
+		Local<Array> array = arg.As<Array>();
+
+		values.resize(array->Length());
+
+		for(uint32_t i = 0; i < array->Length(); i++){
+			Local<Value> element;
+
+			if(!array->Get(context, i).ToLocal(&element) || !toRational(isolate, element, values[i]))
+				return false;
+		}
+
+		return true;
+	}
+}
+
+void addon::WrappedRational::ReduceAsync(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	/* Context of the currently running JavaScript instance. */
+	Local<Context> context = isolate->GetCurrentContext();
+
+	if(args.Length() != 2){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!args[0]->IsArray() || !args[1]->IsString()){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
+
+	String::Utf8Value name(isolate, args[1]);
+	src::reduction op;
+
+	if(!std::strcmp(*name, "sum"))     op = src::reduction::sum;
+	else
+	if(!std::strcmp(*name, "product")) op = src::reduction::product;
+	else
+	if(!std::strcmp(*name, "min"))     op = src::reduction::min;
+	else
+	if(!std::strcmp(*name, "max"))     op = src::reduction::max;
+	else{
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
+
+	std::vector< rational<long> > values;
+
+	if(!toRationals(isolate, args[0], values)) return;
+
+	/* The empty minimum and maximum do not exist, the empty sum and product need no work. */
+	if(values.empty() && (op == src::reduction::min || op == src::reduction::max)){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
+
+	if(values.empty()){
+		Local<Promise::Resolver> resolver = Promise::Resolver::New(context).ToLocalChecked();
+		args.GetReturnValue().Set(resolver->GetPromise());
+
+		resolver->Resolve(context, NewInstance(isolate, AddonData::From(args), rational<long>(op == src::reduction::sum ? 0 : 1))).Check();
+		return;
+	}
+
+	args.GetReturnValue().Set(reduceBegin(args, values, op, "Rational.reduceAsync"));
+}
+
+void addon::WrappedRational::SumAsync(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	/* Context of the currently running JavaScript instance. */
+	Local<Context> context = isolate->GetCurrentContext();
+
+	if(args.Length() != 2){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	/* Copied rather than pinned, the buffers being free to change or detach while summed. */
+	std::vector< rational<long> > values;
+
+	if(!toRationals(isolate, args[0], args[1], values)) return;
+
+	if(values.empty()){
+		Local<Promise::Resolver> resolver = Promise::Resolver::New(context).ToLocalChecked();
+		args.GetReturnValue().Set(resolver->GetPromise());
+
+		resolver->Resolve(context, NewInstance(isolate, AddonData::From(args), rational<long>())).Check();
+		return;
+	}
+
+	args.GetReturnValue().Set(reduceBegin(args, values, src::reduction::sum, "Rational.sumAsync"));
+}
+
+void addon::WrappedRational::SortAsync(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!args[0]->IsArray()){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
+
+	std::vector< rational<long> > values;
+
+	if(!toRationals(isolate, args[0], values)) return;
+
+	BatchJob *job = new BatchJob();
+
+	args.GetReturnValue().Set(asyncBegin(job, isolate, AddonData::From(args), "Rational.sortAsync"));
+
+	job->values.swap(values);
+	job->request.data = job;
+
+	uv_queue_work(node::GetCurrentEventLoop(isolate), &job->request, batchWork, batchDone);
+}
+
+void addon::WrappedRational::ParseAsync(const FunctionCallbackInfo<Value>& args){
+
+	/* Pointer to v8::Isolate object that represents the v8 instance itself. */
+	Isolate *isolate = args.GetIsolate();
+
+	/* Context of the currently running JavaScript instance. */
+	Local<Context> context = isolate->GetCurrentContext();
+
+	if(args.Length() != 1){
+		throwException(isolate, Exception::TypeError, "Rational: invalid number of arguments");
+		return;
+	}
+
+	if(!args[0]->IsArray()){
+		throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+		return;
+	}
+
+	Local<Array> array = args[0].As<Array>();
+	std::vector<std::string> strings(array->Length());
+
+	for(uint32_t i = 0; i < array->Length(); i++){
+		Local<Value> element;
+
+		if(!array->Get(context, i).ToLocal(&element)) return;
+
+		if(!element->IsString()){
+			throwException(isolate, Exception::TypeError, "Rational: invalid argument");
+			return;
+		}
+
+		String::Utf8Value str(isolate, element);
+		strings[i].assign(*str, str.length());
+	}
+
+	BatchJob *job = new BatchJob();
+
+	args.GetReturnValue().Set(asyncBegin(job, isolate, AddonData::From(args), "Rational.parseAsync"));
+
+	job->strings.swap(strings);
+	job->request.data = job;
+
+	uv_queue_work(node::GetCurrentEventLoop(isolate), &job->request, batchWork, batchDone);
+}
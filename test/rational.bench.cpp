@@ -0,0 +1,315 @@
+/**
+ * @file	rational.bench.cpp
+ * @author  Essam A. El-Sherif
+ * @version v1.0.0
+ *
+ * A micro benchmarking module for the kernels used by the rational template class defined by rational.h
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../include/rational.h"
+#include "../include/rational_vector.h"
+#include "../include/rational_accumulator.h"
+#include "../include/rational_parallel.h"
+
+/**
+ * A namespace to enclose the micro benchmarking code.
+ */
+namespace ubench{
+
+	using namespace src;
+
+	/** Number of operand pairs per run. */
+	const std::size_t count = 1000000;
+
+	/** Number of runs, the fastest one is reported. */
+	const int runs = 5;
+
+	/** Prevents the compiler from discarding the benchmarked results. */
+	volatile long long sink = 0;
+
+	/** Time the given function over all operand pairs and return nanoseconds per call. */
+	template<typename I, typename F>
+	double measure(const std::vector<I>& a, const std::vector<I>& b, F f){
+		double best = 0.0;
+
+		for(int run = 0; run < runs; run++){
+			long long acc = 0;
+
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			for(std::size_t i = 0; i < a.size(); i++)
+				acc += static_cast<long long>(f(a[i], b[i]));
+			std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+			sink = sink + acc;
+
+			double ns = std::chrono::duration<double, std::nano>(stop - start).count() / a.size();
+			if(run == 0 || ns < best) best = ns;
+		}
+
+		return best;
+	}
+
+	/** Generate uniformly distributed random operands of the given type. */
+	template<typename I>
+	std::vector<I> operands(std::mt19937_64& gen){
+		std::uniform_int_distribution<I> dist(I(1), (std::numeric_limits<I>::max)());
+		std::vector<I> v(count);
+
+		for(std::size_t i = 0; i < v.size(); i++)
+			v[i] = dist(gen);
+
+		return v;
+	}
+
+	/** Time sorting the given rationals with the given comparison kernel, return nanoseconds per element. */
+	template<typename I, typename F>
+	double measure_sort(const std::vector< rational<I> >& v, F f){
+		double best = 0.0;
+
+		for(int run = 0; run < runs; run++){
+			std::vector< rational<I> > w(v);
+
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			std::sort(w.begin(), w.end(), [f](const rational<I>& x, const rational<I>& y){ return f(x, y) < 0; });
+			std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+			sink = sink + static_cast<long long>(w.front().numerator());
+
+			double ns = std::chrono::duration<double, std::nano>(stop - start).count() / v.size();
+			if(run == 0 || ns < best) best = ns;
+		}
+
+		return best;
+	}
+
+	/** Report a single comparison between the two gcd kernels. */
+	template<typename I>
+	void report(const std::string& desc, std::mt19937_64& gen){
+		std::vector<I> a = operands<I>(gen);
+		std::vector<I> b = operands<I>(gen);
+
+		double euclid = measure(a, b, [](I x, I y){ return euclid_gcd(x, y); });
+		double binary = measure(a, b, [](I x, I y){ return binary_gcd(x, y); });
+
+		std::cout << std::fixed << std::setprecision(2)
+			<< "▶ " << std::left << std::setw(10) << desc
+			<< " euclid " << std::right << std::setw(7) << euclid << " ns/op"
+			<< "   binary " << std::setw(7) << binary << " ns/op"
+			<< "   speedup x" << euclid / binary << std::endl;
+	}
+
+	/** Report a single comparison between the two comparison kernels. */
+	template<typename I>
+	void report_sort(const std::string& desc, std::mt19937_64& gen){
+		std::vector<I> a = operands<I>(gen);
+		std::vector<I> b = operands<I>(gen);
+		std::vector< rational<I> > v(a.size());
+
+		for(std::size_t i = 0; i < v.size(); i++)
+			v[i] = rational<I>(i % 2 ? a[i] : -a[i], b[i]);
+
+		double cf    = measure_sort(v, [](const rational<I>& x, const rational<I>& y){ return cf_compare(x, y); });
+		double cross = measure_sort(v, [](const rational<I>& x, const rational<I>& y){ return cross_compare(x, y); });
+
+		std::cout << std::fixed << std::setprecision(2)
+			<< "▶ " << std::left << std::setw(10) << desc
+			<< " cf     " << std::right << std::setw(7) << cf << " ns/el"
+			<< "   cross  " << std::setw(7) << cross << " ns/el"
+			<< "   speedup x" << cf / cross << std::endl;
+	}
+
+	/** Time the given batch operation, return nanoseconds per element. */
+	template<typename V, typename F>
+	double measure_batch(const V& a, const V& b, std::size_t n, F f){
+		double best = 0.0;
+
+		for(int run = 0; run < runs; run++){
+			V w(a);
+
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			f(w, b);
+			std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+			sink = sink + static_cast<long long>(w.size());
+
+			double ns = std::chrono::duration<double, std::nano>(stop - start).count() / n;
+			if(run == 0 || ns < best) best = ns;
+		}
+
+		return best;
+	}
+
+	/** Report a single comparison between scalar loops and the structure of arrays batch kernels. */
+	template<typename I>
+	void report_batch(const std::string& desc, std::mt19937_64& gen){
+		std::uniform_int_distribution<I> dist(I(1), I(1) << (std::numeric_limits<I>::digits / 2 - 1));
+
+		std::vector< rational<I> > a(count), b(count);
+		rational_vector<I> va, vb;
+
+		for(std::size_t i = 0; i < count; i++){
+			a[i] = rational<I>(i % 2 ? dist(gen) : -dist(gen), dist(gen));
+			b[i] = rational<I>(dist(gen), dist(gen));
+			va.push_back(a[i]);
+			vb.push_back(b[i]);
+		}
+
+		typedef std::vector< rational<I> > S;
+		typedef rational_vector<I> V;
+
+		double scalar = measure_batch(a, b, count, [](S& x, const S& y){ for(std::size_t i = 0; i < x.size(); i++) x[i] += y[i]; });
+		double batch  = measure_batch(va, vb, count, [](V& x, const V& y){ x += y; });
+
+		std::cout << std::fixed << std::setprecision(2)
+			<< "▶ " << std::left << std::setw(10) << desc + " +"
+			<< " scalar " << std::right << std::setw(7) << scalar << " ns/el"
+			<< "   batch  " << std::setw(7) << batch << " ns/el"
+			<< "   speedup x" << scalar / batch << std::endl;
+
+		std::vector<int> c(count);
+
+		scalar = measure_batch(a, b, count, [&c](S& x, const S& y){ for(std::size_t i = 0; i < x.size(); i++) c[i] = x[i].compare(y[i]); });
+		batch  = measure_batch(va, vb, count, [&c](V& x, const V& y){ c = x.compare(y); });
+
+		std::cout << std::fixed << std::setprecision(2)
+			<< "▶ " << std::left << std::setw(10) << desc + " <=>"
+			<< " scalar " << std::right << std::setw(7) << scalar << " ns/el"
+			<< "   batch  " << std::setw(7) << batch << " ns/el"
+			<< "   speedup x" << scalar / batch << std::endl;
+	}
+
+	/** Report a single comparison between normalizing sums and the deferred normalization accumulator. */
+	template<typename I>
+	void report_sum(const std::string& desc, std::mt19937_64& gen){
+		const I dens[] = { 1, 2, 4, 5, 8, 10, 20, 25, 40, 50, 100 };
+
+		std::uniform_int_distribution<I> num(I(-9999), I(9999));
+		std::uniform_int_distribution<int> den(0, sizeof(dens) / sizeof(dens[0]) - 1);
+
+		std::vector< rational<I> > v(count);
+		for(std::size_t i = 0; i < v.size(); i++)
+			v[i] = rational<I>(num(gen), dens[den(gen)]);
+
+		typedef std::vector< rational<I> > S;
+
+		double scalar = measure_batch(v, v, count, [](S& x, const S& y){
+			rational<I> r;
+			for(std::size_t i = 0; i < y.size(); i++) r += y[i];
+			x[0] = r;
+		});
+		double deferred = measure_batch(v, v, count, [](S& x, const S& y){
+			rational_accumulator<I> a;
+			for(std::size_t i = 0; i < y.size(); i++) a += y[i];
+			x[0] = a.value();
+		});
+
+		std::cout << std::fixed << std::setprecision(2)
+			<< "▶ " << std::left << std::setw(10) << desc
+			<< " scalar " << std::right << std::setw(7) << scalar << " ns/el"
+			<< "   deferred " << std::setw(5) << deferred << " ns/el"
+			<< "   speedup x" << scalar / deferred << std::endl;
+	}
+
+	/** Report a single comparison between formatting through a string stream and formatting in place. */
+	template<typename I>
+	void report_format(const std::string& desc, std::mt19937_64& gen){
+		std::uniform_int_distribution<I> num((std::numeric_limits<I>::min)(), (std::numeric_limits<I>::max)());
+		std::uniform_int_distribution<I> den(I(1), (std::numeric_limits<I>::max)());
+
+		std::vector< rational<I> > v(count);
+		for(std::size_t i = 0; i < v.size(); i++)
+			v[i] = rational<I>(num(gen), den(gen));
+
+		typedef std::vector< rational<I> > S;
+
+		double stream = measure_batch(v, v, count, [](S& x, const S& y){
+			std::ostringstream os;
+			for(std::size_t i = 0; i < y.size(); i++){
+				inner_put(os, y[i], std::false_type());
+				os << ',';
+			}
+			x[0] = rational<I>(static_cast<I>(os.str().size()));
+		});
+		double chars = measure_batch(v, v, count, [](S& x, const S& y){
+			std::string out(y.size() * (2 * (std::numeric_limits<I>::digits10 + 2) + 2), '\0');
+			char *p = &out[0], *last = p + out.size();
+			for(std::size_t i = 0; i < y.size(); i++){
+				p = to_chars(p, last, y[i]).ptr;
+				*p++ = ',';
+			}
+			x[0] = rational<I>(static_cast<I>(p - &out[0]));
+		});
+
+		std::cout << std::fixed << std::setprecision(2)
+			<< "▶ " << std::left << std::setw(10) << desc
+			<< " stream " << std::right << std::setw(7) << stream << " ns/el"
+			<< "   chars  " << std::setw(7) << chars << " ns/el"
+			<< "   speedup x" << stream / chars << std::endl;
+	}
+
+	/** Report the scaling of the parallel reduction with the number of threads. */
+	template<typename I>
+	void report_reduce(const std::string& desc, std::mt19937_64& gen){
+		std::uniform_int_distribution<I> num(I(-9999), I(9999));
+		std::uniform_int_distribution<I> den(I(1), I(12));
+
+		std::vector< rational<I> > v(count * 4);
+		for(std::size_t i = 0; i < v.size(); i++)
+			v[i] = rational<I>(num(gen), den(gen));
+
+		typedef std::vector< rational<I> > S;
+
+		const double base = measure_batch(v, v, v.size(), [](S& x, const S& y){
+			thread_pool pool(0);
+			x[0] = parallel_reduce(pool, y.data(), y.size(), reduction::sum);
+		});
+
+		std::cout << std::fixed << std::setprecision(2)
+			<< "▶ " << std::left << std::setw(10) << desc
+			<< " 1 thread " << std::right << std::setw(5) << base << " ns/el";
+
+		for(std::size_t threads = 2; threads <= std::thread::hardware_concurrency(); threads *= 2){
+			thread_pool pool(threads - 1);
+
+			const double t = measure_batch(v, v, v.size(), [&pool](S& x, const S& y){
+				x[0] = parallel_reduce(pool, y.data(), y.size(), reduction::sum);
+			});
+
+			std::cout << "   " << threads << " threads x" << base / t;
+		}
+
+		std::cout << std::endl;
+	}
+}
+
+int main(){
+	using namespace ubench;
+
+	std::mt19937_64 gen(20240101u);
+
+	report<std::int32_t>("gcd int32", gen);
+	report<std::int64_t>("gcd int64", gen);
+
+	report_sort<std::int32_t>("sort int32", gen);
+	report_sort<std::int64_t>("sort int64", gen);
+
+	report_batch<std::int32_t>("int32", gen);
+
+	report_sum<long>("sum long", gen);
+
+	report_reduce<long>("reduce", gen);
+
+	report_format<long>("format", gen);
+
+	return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @module  rational-bench
+ * @desc    A module for micro benchmarking the C++ addon-generated Rational class.
+ * @version 1.0.0
+ * @author  Essam A. El-Sherif
+ */
+
+/**
+ * @const rational_addon {object} The C++ addon exported object.
+ */
+const rational_addon = require('../build/Release/rational');
+
+/** @const {number} count - Number of operations per run. */
+const count = Number(process.argv[2]) || 1000000;
+
+/** @const {number} runs - Number of runs, the fastest one is reported. */
+const runs = 5;
+
+/**
+ * @func  measure
+ * @param {function} f - The benchmarked function, called once per run.
+ * @returns {number} Nanoseconds per operation of the fastest run.
+ * @desc  Time the given function.
+ */
+function measure(f){
+	let best = Infinity;
+
+	for(let run = 0; run < runs; run++){
+		const start = process.hrtime.bigint();
+		f();
+		const stop = process.hrtime.bigint();
+
+		best = Math.min(best, Number(stop - start) / count);
+	}
+
+	return best;
+}
+
+/**
+ * @func  report
+ * @param {string} desc - The benchmark description.
+ * @param {number} ns - Nanoseconds per operation.
+ * @param {string} [extra] - Additional figures.
+ * @desc  Print a single benchmark result.
+ */
+function report(desc, ns, extra = ''){
+	console.log(`▶ ${desc.padEnd(24)} ${ns.toFixed(2).padStart(8)} ns/op ${(1e3 / ns).toFixed(2).padStart(8)} Mops/s${extra}`);
+}
+
+/**
+ * @func Main
+ * @desc The application entry point function.
+ */
+(() => {
+	const { Rational } = rational_addon;
+	const one = new Rational(1, 3);
+
+	/* A chain of add() calls, each creating a new Rational object. */
+	report('add() chain', measure(() => {
+		let r = new Rational();
+		for(let i = 0; i < count; i++){
+			r = r.add(one);
+			if(i % 1024 === 1023) r = new Rational();
+		}
+	}));
+
+	/* A chain of selfAdd() calls, creating no objects. */
+	report('selfAdd() chain', measure(() => {
+		let r = new Rational();
+		for(let i = 0; i < count; i++){
+			r.selfAdd(one);
+			if(i % 1024 === 1023) r.assign(0);
+		}
+	}));
+
+	/* A chain of static add() calls writing into a given object, creating no objects. */
+	report('Rational.add() chain', measure(() => {
+		const r = new Rational();
+		for(let i = 0; i < count; i++){
+			Rational.add(r, one, r);
+			if(i % 1024 === 1023) r.assign(0);
+		}
+	}));
+
+	/*
+	 * Calls with fast API overloads, taken once TurboFan optimizes the loop. Run with
+	 * '--no-turbo-fast-api-calls' for the figures of the regular callbacks.
+	 */
+	let sink = 0;
+
+	report('lessThan() loop', measure(() => {
+		for(let i = 0; i < count; i++)
+			if(one.lessThan(i & 1)) sink++;
+	}));
+
+	report('equalTo() loop', measure(() => {
+		for(let i = 0; i < count; i++)
+			if(one.equalTo(i & 1)) sink++;
+	}));
+
+	report('valueOf() loop', measure(() => {
+		for(let i = 0; i < count; i++)
+			sink += one.valueOf();
+	}));
+
+	report('getNumerator() loop', measure(() => {
+		for(let i = 0; i < count; i++)
+			sink += one.getNumerator();
+	}));
+
+	/* Memory retained by live Rational objects, the native part only visible in the resident set. */
+	global.gc?.();
+	const before = process.memoryUsage();
+
+	const live = [];
+	for(let i = 0; i < count; i++)
+		live.push(new Rational(i, 7));
+
+	global.gc?.();
+	const after = process.memoryUsage();
+
+	console.log(
+		`▶ ${'live objects'.padEnd(24)}` +
+		` heap ${((after.heapUsed - before.heapUsed) / live.length).toFixed(1).padStart(6)} B/obj` +
+		`   rss ${((after.rss - before.rss) / live.length).toFixed(1).padStart(6)} B/obj`
+	);
+})('Main Function');
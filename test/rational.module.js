@@ -27,862 +27,2455 @@ class Rational{
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg1 - [Optional] Rational object or numerator.
-	 * @param    {string} arg2 - [Optional] denominator.
-	 * @desc     Constructs a new Rational object.
-	 * @throws   {TypeError} If more than two arguments are given, or invalid argument type is used.
+	 * @param    {Array}  array - Rational objects or integer numbers.
+	 * @param    {string} op - The reduction, one of 'sum', 'product', 'min' or 'max'.
+	 * @returns  {Promise} A promise of a new Rational object.
+	 * @desc     Reduces an array of rationals off the main thread.
+	 * @throws   {TypeError} If other than two arguments are given, invalid argument type is used, or the minimum or maximum of an empty array is requested.
 	 */
-	constructor(arg1, arg2){
-		switch(arguments.length){
-			case 0:
-				this.den = 1;
-				this.num = 0;
-				break;
-			case 1:
-				if(typeof arg1 === 'object' && arg1 instanceof Rational){
-					this.den = arg1.getDenominator();
-					this.num = arg1.getNumerator();
-				}
-				else{
-					this.den = 1;
-					this.num = this._validate(arg1);
-				}
-				break;
-			case 2:
-				this.den = this._validate(arg2);
-				this.num = this._validate(arg1);
-				this._normalize();
-				break;
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
+	static reduceAsync(array, op){
+		if(arguments.length !== 2){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(!Array.isArray(array) || !['sum', 'product', 'min', 'max'].includes(op)){
+			throw TypeError(`Rational: invalid argument`);
 		}
 
-		Object.defineProperty(this, 'den', { enumerable: false });
-		Object.defineProperty(this, 'num', { enumerable: false });
+		const values = array.map((e) => new Rational(e));
+
+		switch(op){
+			case 'sum':
+				return Promise.resolve(values.reduce((a, b) => a.selfAdd(b), new Rational(0)));
+			case 'product':
+				return Promise.resolve(values.reduce((a, b) => a.selfMul(b), new Rational(1)));
+		}
+
+		if(values.length === 0){
+			throw TypeError(`Rational: invalid argument`);
+		}
+
+		return Promise.resolve(values.reduce((a, b) => (op === 'min' ? b.lessThan(a) : a.lessThan(b)) ? b : a));
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @param    {any} arg - The argument to be validated as a numerator or denominator.
-	 * @returns  {number} An integer number.
-	 * @desc     Validates the given argument to be used as a numerator or denominator.
-	 * @throws   {TypeError} If the given argument is an invalid numerator or denominator.
+	 * @param    {object|number} a - Rational object or an integer.
+	 * @param    {object|number} b - Rational object or an integer.
+	 * @param    {object} out - Rational object the sum is written into.
+	 * @returns  {object} The Rational object written into.
+	 * @desc     Adds two rationals without creating a Rational object.
+	 * @throws   {TypeError} If other than three arguments are given, or invalid argument type is used.
 	 */
-	_validate(arg){
-		if(typeof arg === 'number' && !Number.isNaN(arg)){
-			return Math.trunc(arg);
-		}
-		else
-		if(typeof arg === 'string' && arg && !isNaN(arg)){
-			return Math.trunc(Number(arg));
-		}
-		else
-		if(typeof arg === 'bigint'){
-			throw TypeError('Rational: BigInt type is not accepted');
-		}
-		else{
-			throw TypeError(`Rational: invalid argument`);
-		}
+	static add(a, b, out){
+		return Rational._into(arguments, 3, (x, y) => x.add(y));
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @desc     Normalizes the rational number i.e. no common factors and denominator is positive.
-	 * @throws   {TypeError} In case of zero denominator.
+	 * @param    {object|number} a - Rational object or an integer.
+	 * @param    {object|number} b - Rational object or an integer.
+	 * @param    {object} out - Rational object the difference is written into.
+	 * @returns  {object} The Rational object written into.
+	 * @desc     Subtracts two rationals without creating a Rational object.
+	 * @throws   {TypeError} If other than three arguments are given, or invalid argument type is used.
 	 */
-	_normalize(){
-		if(this.den === 0){
-			throw TypeError('Rational: bad rational, zero denominator');
-		}
-		else
-		if(this.num === 0){
-			this.den = 1;
-		}
-		else{
-			let g = Math.abs( Rational.gcd(this.num, this.den) );
+	static sub(a, b, out){
+		return Rational._into(arguments, 3, (x, y) => x.sub(y));
+	}
 
-			this.num /= g;
-			this.den /= g;
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} a - Rational object or an integer.
+	 * @param    {object|number} b - Rational object or an integer.
+	 * @param    {object} out - Rational object the product is written into.
+	 * @returns  {object} The Rational object written into.
+	 * @desc     Multiplies two rationals without creating a Rational object.
+	 * @throws   {TypeError} If other than three arguments are given, or invalid argument type is used.
+	 */
+	static mul(a, b, out){
+		return Rational._into(arguments, 3, (x, y) => x.mul(y));
+	}
 
-			if(this.den < 0){
-				this.num = -this.num;
-				this.den = -this.den;
-			}
-		}
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} a - Rational object or an integer.
+	 * @param    {object|number} b - Rational object or an integer.
+	 * @param    {object} out - Rational object the quotient is written into.
+	 * @returns  {object} The Rational object written into.
+	 * @desc     Divides two rationals without creating a Rational object.
+	 * @throws   {TypeError} If other than three arguments are given, invalid argument type is used, or division by zero.
+	 */
+	static div(a, b, out){
+		return Rational._into(arguments, 3, (x, y) => x.div(y));
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @desc     An accessor function to return the numerator.
-	 * @returns  {number} The numerator.
+	 * @param    {object|number} a - Rational object or an integer.
+	 * @param    {object|number} n - An integer exponent.
+	 * @param    {object} out - Rational object the power is written into.
+	 * @returns  {object} The Rational object written into.
+	 * @desc     Raises a rational to an integer power without creating a Rational object.
+	 * @throws   {TypeError} If other than three arguments are given, invalid argument type is used, or division by zero.
 	 */
-	getNumerator(){ return this.num; }
+	static pow(a, n, out){
+		return Rational._into(arguments, 3, (x, y) => {
+			if(y.getDenominator() !== 1){
+				throw TypeError(`Rational: invalid argument`);
+			}
+			return x.pow(y.getNumerator());
+		});
+	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @desc     An accessor function to return the denominator.
-	 * @returns  {number} The denominator.
+	 * @param    {object|number} a - Rational object or an integer.
+	 * @param    {object} out - Rational object the negation is written into.
+	 * @returns  {object} The Rational object written into.
+	 * @desc     Negates a rational without creating a Rational object.
+	 * @throws   {TypeError} If other than two arguments are given, or invalid argument type is used.
 	 */
-	getDenominator(){ return this.den; }
+	static neg(a, out){
+		return Rational._into(arguments, 2, (x) => x.neg());
+	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg1 - [Optional] Rational object or numerator.
-	 * @param    {string} arg2 - [Optional] denominator.
-	 * @desc     Assignment to this Rational object.
-	 * @throws   {TypeError} If neither of one or two arguments are given, or invalid argument type is used.
+	 * @param    {object|number} a - Rational object or an integer.
+	 * @param    {object} out - Rational object the absolute value is written into.
+	 * @returns  {object} The Rational object written into.
+	 * @desc     Takes the absolute value of a rational without creating a Rational object.
+	 * @throws   {TypeError} If other than two arguments are given, or invalid argument type is used.
 	 */
-	assign(arg1, arg2){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg1 === 'object' && arg1 instanceof Rational){
-					this.num = arg1.getNumerator();
-					this.den = arg1.getDenominator();
-				}
-				else{
-					this.num = this._validate(arg1);
-					this.den = 1;
-				}
-				break;
-			case 2:
-				this.num = this._validate(arg1);
-				this.den = this._validate(arg2);
-				this._normalize();
-				break;
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
-		}
+	static abs(a, out){
+		return Rational._into(arguments, 2, (x) => x.abs());
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Adds to this Rational object another Rational object or an integer value.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {number|bigint} x - The number converted.
+	 * @param    {number} bound - [Optional] The largest denominator.
+	 * @desc     Converts a number exactly, or to the closest rational with a denominator up to the bound.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If other than one or two arguments are given, or invalid argument type is used.
+	 * @throws   {RangeError} If the number is out of the 64-bit range.
 	 */
-	selfAdd(arg){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg === 'object' && arg instanceof Rational){
-					let r_num = arg.getNumerator();
-					let r_den = arg.getDenominator();
+	static fromNumber(x, bound){
+		if(arguments.length !== 1 && arguments.length !== 2){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(typeof x !== 'number' && typeof x !== 'bigint'){
+			throw TypeError(`Rational: invalid argument`);
+		}
+		if(arguments.length === 2){
+			bound = Rational._bound(bound);
+		}
+		if(arguments.length === 1 || typeof x === 'bigint' || Number.isInteger(x) || !Number.isFinite(x)){
+			const r = new Rational(x);
+			return Rational._result(r.num, r.den);
+		}
 
-					let g = Rational.gcd(this.den, r_den);
+		/* The exact value of the double, doubling it until integral. */
+		let den = 1n;
+		for( ; !Number.isInteger(x); den *= 2n) x *= 2;
 
-					this.den /= g;
-					this.num = this.num * (r_den / g) + r_num * this.den;
+		const [num, d] = Rational._limit(BigInt(x), den, bound);
+		return Rational._result(num, d);
+	}
 
-					g = Math.abs( Rational.gcd(this.num, g) );
-					this.num /= g;
-					this.den *= (r_den/g);
-				}
-				else{
-					arg = this._validate(arg);
-					this.num += arg * this.den;
-				}
-				return this;
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
+	/**
+	 * @method
+	 * @static
+	 * @private
+	 * @memberof module:rational-module.Rational
+	 * @param    {any} bound - The largest denominator of an approximation.
+	 * @returns  {bigint} The bound.
+	 * @desc     Validates the bound of the denominator of an approximation.
+	 * @throws   {TypeError} If the bound is not an integer of at least 1.
+	 */
+	static _bound(bound){
+		bound = new Rational()._validate(bound);
+
+		if(bound < 1){
+			throw TypeError(`Rational: invalid argument`);
 		}
+
+		return BigInt(bound);
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
+	 * @private
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Subtracts from this Rational object another Rational object or an integer value.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {bigint} num - Numerator.
+	 * @param    {bigint} den - Positive denominator.
+	 * @param    {bigint} bound - The largest denominator.
+	 * @returns  {number[]} The numerator and denominator of the closest rational with a denominator up to the bound.
+	 * @desc     Takes the convergents of the continued fraction of num/den, then the best semiconvergent.
 	 */
-	selfSub(arg){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg === 'object' && arg instanceof Rational){
-					let r_num = arg.getNumerator();
-					let r_den = arg.getDenominator();
+	static _limit(num, den, bound){
+		if(den <= bound){
+			return [Number(num), Number(den)];
+		}
 
-					let g = Rational.gcd(this.den, r_den);
+		let [p0, q0, p1, q1] = [0n, 1n, 1n, 0n];
+		let [n, d] = [num, den];
 
-					this.den /= g;
-					this.num = this.num * (r_den / g) - r_num * this.den;
+		for(;;){
+			let a = n / d;
+			if(n % d !== 0n && n < 0n) a -= 1n;
 
-					g = Math.abs( Rational.gcd(this.num, g) );
-					this.num /= g;
-					this.den *= (r_den/g);
-				}
-				else{
-					arg = this._validate(arg);
-					this.num -= arg * this.den;
-				}
-				return this;
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
+			const q2 = q0 + a * q1;
+			if(q2 > bound) break;
+
+			[p0, q0, p1, q1] = [p1, q1, p0 + a * p1, q2];
+			[n, d] = [d, n - a * d];
+		}
+
+		const k = (bound - q0) / q1;
+
+		/* The distances to p1/q1 and to the semiconvergent are d/(den·q1) and (n - k·d)/(den·qk). */
+		if(d * (q0 + k * q1) <= (n - k * d) * q1){
+			return [Number(p1), Number(q1)];
 		}
+
+		return [Number(p0 + k * p1), Number(q0 + k * q1)];
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Multiplies this Rational object by another Rational object or an integer value.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {number} bound - The largest absolute numerator and denominator cached, 0 to disable the cache.
+	 * @desc     Sets the bound of the cache of frozen small rationals the non-mutating operations return.
+	 * @throws   {TypeError} If other than one argument is given, or invalid argument type is used.
 	 */
-	selfMul(arg){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg === 'object' && arg instanceof Rational){
-					let r_num = arg.getNumerator();
-					let r_den = arg.getDenominator();
-
-					let gcd1 = Math.abs( Rational.gcd(this.num, r_den) );
-					let gcd2 = Math.abs( Rational.gcd(r_num, this.den) );
+	static setCache(bound){
+		if(arguments.length !== 1){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
 
-					this.num = (this.num/gcd1) * (r_num/gcd2);
-					this.den = (this.den/gcd2) * (r_den/gcd1);
-				}
-				else{
-					arg = this._validate(arg);
+		bound = new Rational()._validate(bound);
 
-					let gcd = Math.abs( Rational.gcd( arg, this.den ) );
-					this.num *= arg / gcd;
-					this.den /= gcd;
-				}
-				return this;
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
+		if(bound < 0 || bound > 64){
+			throw TypeError(`Rational: invalid argument`);
 		}
+
+		Rational._cache = new Map();
+		Rational._cacheBound = bound;
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
+	 * @private
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Divides this Rational object by another Rational object or an integer value.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {number} num - Numerator.
+	 * @param    {number} den - Denominator.
+	 * @returns  {object} The result of a non-mutating operation.
+	 * @desc     Returns the shared frozen Rational object when within the bound of the cache, a new one otherwise.
 	 */
-	selfDiv(arg){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg === 'object' && arg instanceof Rational){
-
-					let r_num = arg.getNumerator();
-					let r_den = arg.getDenominator();
+	static _result(num, den){
+		const r = new Rational(num, den);
+		const bound = Rational._cacheBound;
 
-					if(r_num === 0){
-						throw TypeError(`Rational: division by zero`);
-					}
+		if(Math.abs(r.num) > bound || r.den > bound){
+			return r;
+		}
 
-					if(this.num === 0) return this;
+		const key = r.toString();
 
-					let gcd1 = Math.abs( Rational.gcd(this.num, r_num) );
-					let gcd2 = Math.abs( Rational.gcd(r_den, this.den) );
+		if(!Rational._cache.has(key)){
+			const constant = ['ZERO', 'ONE', 'TWO', 'MINUS_ONE', 'HALF'].map((name) => Rational[name]).find((c) => c.equalTo(r));
+			Rational._cache.set(key, constant ?? Object.freeze(r));
+		}
 
-					this.num = (this.num/gcd1) * (r_den/gcd2);
-					this.den = (this.den/gcd2) * (r_num/gcd1);
+		return Rational._cache.get(key);
+	}
 
-					if(this.den < 0){
-						this.num = -this.num;
-						this.den = -this.den;
-					}
-				}
-				else{
-					arg = this._validate(arg);
-
-					if(arg === 0){
-						throw TypeError(`Rational: division by zero`);
-					}
-
- 					if(this.num == 0) return this;
+	/**
+	 * @method
+	 * @static
+	 * @private
+	 * @memberof module:rational-module.Rational
+	 * @param    {string} str - The "n/d" or "n" form given by toString().
+	 * @returns  {object} A new Rational object.
+	 * @desc     Parses a string as a whole, the one parser of string arguments.
+	 * @throws   {TypeError} If the string is not a rational, or in case of zero denominator.
+	 * @throws   {RangeError} If a term is out of the 64-bit range.
+	 */
+	static _parse(str){
+		if(!/^-?\d+(\/-?\d+)?$/.test(str)){
+			throw TypeError(`Rational: invalid argument`);
+		}
 
-					let gcd = Math.abs( Rational.gcd(this.num, arg) );
-					this.num = this.num / gcd;
-					this.den *= (arg / gcd);
+		const [n, d = '1'] = str.split('/');
 
-					if(this.den < 0){
-						this.num = -this.num;
-						this.den = -this.den;
-					}
-				}
-				return this;
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
+		if(BigInt(d) === 0n){
+			throw TypeError(`Rational: bad rational, zero denominator`);
 		}
+
+		return new Rational(BigInt(n), BigInt(d));
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
+	 * @private
 	 * @memberof module:rational-module.Rational
-	 * @param    {number} arg - Integer number.
-	 * @desc     Raise this Rational object to the power given.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {any} arg - An argument of a constructor or an arithmetic method.
+	 * @returns  {any} The exact Rational object of a fractional number or a string, the argument itself otherwise.
+	 * @desc     Converts a finite non-integer number into the dyadic rational it holds, doubling it until integral,
+	 *           and a string by _parse().
+	 * @throws   {RangeError} If the denominator is out of the 64-bit range.
 	 */
-	selfPow(arg){
-		switch(arguments.length){
-			case 1:
-				arg = this._validate(arg);
+	static _exact(arg){
+		if(typeof arg === 'string'){
+			return Rational._parse(arg);
+		}
 
-				let r = new Rational(1);
-				for(let i = 0; i < Math.abs(arg); i++){
-					r = r.selfMul(this);
-				}
-				if(arg < 0){
-					r = (new Rational(1)).selfDiv(r);
-				}
+		if(typeof arg !== 'number' || !Number.isFinite(arg) || Number.isInteger(arg)){
+			return arg;
+		}
 
-				this.num = r.getNumerator();
-				this.den = r.getDenominator();
-				return this;
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
+		let den = 1;
+		for( ; !Number.isInteger(arg); den *= 2) arg *= 2;
+
+		if(den >= 2 ** 63){
+			throw RangeError('Rational: arithmetic overflow');
 		}
+
+		return new Rational(arg, den);
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
+	 * @private
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Adds this Rational object to another Rational object or an integer value.
-	 * @returns  {object} New Rational object.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {any} arg1 - Numerator.
+	 * @param    {any} arg2 - Denominator.
+	 * @returns  {number[]} The numerator and denominator of the quotient, in lowest terms.
+	 * @desc     Divides the exact values of the given numerator and denominator.
+	 * @throws   {TypeError} In case of zero denominator.
 	 */
-	add(arg){
-		switch(arguments.length){
-			case 1:
-				let _num = this.num;
-				let _den = this.den;
-
-				if(typeof arg === 'object' && arg instanceof Rational){
-					let r_num = arg.getNumerator();
-					let r_den = arg.getDenominator();
-
-					let g = Rational.gcd(_den, r_den);
-
-					_den /= g;
-					_num = _num * (r_den / g) + r_num * _den;
+	static _quotient(arg1, arg2){
+		const d = new Rational(arg2);
 
-					g = Math.abs( Rational.gcd(_num, g) );
-					_num /= g;
-					_den *= (r_den/g);
-				}
-				else{
-					arg = this._validate(arg);
-					_num += arg * _den;
-				}
-				return new Rational(_num, _den);
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
+		if(d.num === 0){
+			throw TypeError('Rational: bad rational, zero denominator');
 		}
+
+		const q = new Rational(arg1).selfDiv(d);
+		return [q.num, q.den];
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
+	 * @private
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Subtracts from this Rational object another Rational object or an integer value.
-	 * @returns  {object} New Rational object.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {Arguments} args - The operands followed by the Rational object written into.
+	 * @param    {number}    argc - The number of arguments expected.
+	 * @param    {Function}  op - The operation on the operands, as Rational objects.
+	 * @returns  {object} The Rational object written into.
+	 * @desc     Writes the result of an operation into the Rational object given last.
+	 * @throws   {TypeError} If other than argc arguments are given, invalid argument type is used, or the object written into is frozen.
 	 */
-	sub(arg){
-		switch(arguments.length){
-			case 1:
-				let _num = this.num;
-				let _den = this.den;
+	static _into(args, argc, op){
+		if(args.length !== argc){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
 
-				if(typeof arg === 'object' && arg instanceof Rational){
-					let r_num = arg.getNumerator();
-					let r_den = arg.getDenominator();
+		const operands = [...args].slice(0, -1).map((e) => new Rational(e));
+		const out = args[argc - 1];
 
-					let g = Rational.gcd(_den, r_den);
+		if(!(out instanceof Rational)){
+			throw TypeError(`Rational: invalid argument`);
+		}
 
-					_den /= g;
-					_num = _num * (r_den / g) - r_num * _den;
+		out._mutable();
 
-					g = Math.abs( Rational.gcd(_num, g) );
-					_num /= g;
-					_den *= (r_den/g);
-				}
-				else{
-					arg = this._validate(arg);
-					_num -= arg * _den;
-				}
-				return new Rational(_num, _den);
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
-		}
+		const r = op(...operands);
+
+		out.num = r.num;
+		out.den = r.den;
+
+		return out;
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Multiplies this Rational object by another Rational object or an integer value.
-	 * @returns  {object} New Rational object.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {TypedArray} num - Numerators, an Int32Array, BigInt64Array or Float64Array of integers.
+	 * @param    {TypedArray} den - Denominators, a typed array of the same kind and length.
+	 * @returns  {Promise} A promise of a new Rational object.
+	 * @desc     Sums the rationals held in typed arrays off the main thread, copying them first.
+	 * @throws   {TypeError} If other than two arguments are given, invalid argument type is used, or a denominator is zero.
 	 */
-	mul(arg){
-		switch(arguments.length){
-			case 1:
-				let _num = this.num;
-				let _den = this.den;
+	static sumAsync(num, den){
+		if(arguments.length !== 2){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
 
-				if(typeof arg === 'object' && arg instanceof Rational){
-					let r_num = arg.getNumerator();
-					let r_den = arg.getDenominator();
+		const kind = [Int32Array, BigInt64Array, Float64Array].find((k) => num instanceof k && den instanceof k);
 
-					let gcd1 = Math.abs( Rational.gcd(_num, r_den) );
-					let gcd2 = Math.abs( Rational.gcd(r_num, _den) );
+		if(!kind || num.length !== den.length || (kind === Float64Array && ![...num, ...den].every((v) => Number.isInteger(v) && Math.abs(v) < 2 ** 63))){
+			throw TypeError(`Rational: invalid argument`);
+		}
 
-					_num = (_num/gcd1) * (r_num/gcd2);
-					_den = (_den/gcd2) * (r_den/gcd1);
-				}
-				else{
-					arg = this._validate(arg);
+		const values = Array.from(num, (n, i) => new Rational(n, den[i]));
 
-					let gcd = Math.abs( Rational.gcd( arg, _den ) );
-					_num *= arg / gcd;
-					_den /= gcd;
-				}
-				return new Rational(_num, _den);
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
-		}
+		return new Promise((resolve) => resolve(values.reduce((a, b) => a.selfAdd(b), new Rational(0))));
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
 	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Divides this Rational object by another Rational object or an integer value.
-	 * @returns  {object} New Rational object.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {Array} array - Rational objects or integer numbers.
+	 * @returns  {Promise} A promise of a new array of Rational objects in ascending order.
+	 * @desc     Sorts an array of rationals off the main thread, copying it first.
+	 * @throws   {TypeError} If other than one argument is given, or invalid argument type is used.
 	 */
-	div(arg){
-		switch(arguments.length){
-			case 1:
-				let _num = this.num;
-				let _den = this.den;
-
-				if(typeof arg === 'object' && arg instanceof Rational){
-
-					let r_num = arg.getNumerator();
-					let r_den = arg.getDenominator();
+	static sortAsync(array){
+		if(arguments.length !== 1){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(!Array.isArray(array)){
+			throw TypeError(`Rational: invalid argument`);
+		}
 
-					if(r_num === 0){
-						throw TypeError(`Rational: division by zero`);
-					}
+		const values = array.map((e) => new Rational(e));
 
-					if(_num === 0) return new Rational(_num, _den);
+		return new Promise((resolve) => resolve(values.sort((a, b) => a.lessThan(b) ? -1 : b.lessThan(a) ? 1 : 0)));
+	}
 
-					let gcd1 = Math.abs( Rational.gcd(_num, r_num) );
-					let gcd2 = Math.abs( Rational.gcd(r_den, _den) );
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.Rational
+	 * @param    {Array} strings - Strings of the form "n/d" or "n".
+	 * @returns  {Promise} A promise of a new array of Rational objects, rejected if a string is not a rational.
+	 * @desc     Parses an array of strings off the main thread, copying them first.
+	 * @throws   {TypeError} If other than one argument is given, or invalid argument type is used.
+	 */
+	static parseAsync(strings){
+		if(arguments.length !== 1){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(!Array.isArray(strings) || !strings.every((e) => typeof e === 'string')){
+			throw TypeError(`Rational: invalid argument`);
+		}
 
-					_num = (_num/gcd1) * (r_den/gcd2);
-					_den = (_den/gcd2) * (r_num/gcd1);
+		return new Promise((resolve) => resolve(strings.map(Rational._parse)));
+	}
 
-					if(_den < 0){
-						_num = -_num;
-						_den = -_den;
-					}
-				}
-				else{
-					arg = this._validate(arg);
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.Rational
+	 * @param    {TypedArray} numA - Numerators of the first operands.
+	 * @param    {TypedArray} denA - Denominators of the first operands.
+	 * @param    {TypedArray} numB - Numerators of the second operands.
+	 * @param    {TypedArray} denB - Denominators of the second operands.
+	 * @param    {TypedArray} outNum - Numerators of the results.
+	 * @param    {TypedArray} outDen - Denominators of the results.
+	 * @desc     Adds rationals held in typed arrays elementwise, storing the results in place.
+	 * @throws   {TypeError} If other than six arguments are given, invalid argument type is used, a denominator is zero.
+	 * @throws   {RangeError} If a result does not fit the element type.
+	 */
+	static addArrays(numA, denA, numB, denB, outNum, outDen){
+		if(arguments.length !== 6){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		Rational._batchArrays('add', [...arguments]);
+	}
 
-					if(arg === 0){
-						throw TypeError(`Rational: division by zero`);
-					}
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.Rational
+	 * @param    {TypedArray} numA - Numerators of the first operands.
+	 * @param    {TypedArray} denA - Denominators of the first operands.
+	 * @param    {TypedArray} numB - Numerators of the second operands.
+	 * @param    {TypedArray} denB - Denominators of the second operands.
+	 * @param    {TypedArray} outNum - Numerators of the results.
+	 * @param    {TypedArray} outDen - Denominators of the results.
+	 * @desc     Subtracts rationals held in typed arrays elementwise, storing the results in place.
+	 * @throws   {TypeError} If other than six arguments are given, invalid argument type is used, a denominator is zero.
+	 * @throws   {RangeError} If a result does not fit the element type.
+	 */
+	static subArrays(numA, denA, numB, denB, outNum, outDen){
+		if(arguments.length !== 6){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		Rational._batchArrays('sub', [...arguments]);
+	}
 
- 					if(_num == 0) return this;
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.Rational
+	 * @param    {TypedArray} numA - Numerators of the first operands.
+	 * @param    {TypedArray} denA - Denominators of the first operands.
+	 * @param    {TypedArray} numB - Numerators of the second operands.
+	 * @param    {TypedArray} denB - Denominators of the second operands.
+	 * @param    {TypedArray} outNum - Numerators of the results.
+	 * @param    {TypedArray} outDen - Denominators of the results.
+	 * @desc     Multiplies rationals held in typed arrays elementwise, storing the results in place.
+	 * @throws   {TypeError} If other than six arguments are given, invalid argument type is used, a denominator is zero.
+	 * @throws   {RangeError} If a result does not fit the element type.
+	 */
+	static mulArrays(numA, denA, numB, denB, outNum, outDen){
+		if(arguments.length !== 6){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		Rational._batchArrays('mul', [...arguments]);
+	}
 
-					let gcd = Math.abs( Rational.gcd(_num, arg) );
-					_num = _num / gcd;
-					_den *= (arg / gcd);
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.Rational
+	 * @param    {TypedArray} numA - Numerators of the first operands.
+	 * @param    {TypedArray} denA - Denominators of the first operands.
+	 * @param    {TypedArray} numB - Numerators of the second operands.
+	 * @param    {TypedArray} denB - Denominators of the second operands.
+	 * @param    {TypedArray} outNum - Numerators of the results.
+	 * @param    {TypedArray} outDen - Denominators of the results.
+	 * @desc     Divides rationals held in typed arrays elementwise, storing the results in place.
+	 * @throws   {TypeError} If other than six arguments are given, invalid argument type is used, a denominator is zero, or a divisor is zero.
+	 * @throws   {RangeError} If a result does not fit the element type.
+	 */
+	static divArrays(numA, denA, numB, denB, outNum, outDen){
+		if(arguments.length !== 6){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		Rational._batchArrays('div', [...arguments]);
+	}
 
-					if(_den < 0){
-						_num = -_num;
-						_den = -_den;
-					}
-				}
-				return new Rational(_num, _den);
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.Rational
+	 * @param    {TypedArray} numA - Numerators of the first operands.
+	 * @param    {TypedArray} denA - Denominators of the first operands.
+	 * @param    {TypedArray} numB - Numerators of the second operands.
+	 * @param    {TypedArray} denB - Denominators of the second operands.
+	 * @param    {Int32Array} out - Comparisons, -1, 0 or 1.
+	 * @desc     Compares rationals held in typed arrays elementwise, storing the results in place.
+	 * @throws   {TypeError} If other than five arguments are given, invalid argument type is used, or a denominator is zero.
+	 */
+	static compareArrays(numA, denA, numB, denB, out){
+		if(arguments.length !== 5){
+			throw TypeError(`Rational: invalid number of arguments`);
 		}
+		Rational._batchArrays('compare', [...arguments]);
 	}
 
 	/**
 	 * @method
-	 * @instance
+	 * @static
+	 * @private
 	 * @memberof module:rational-module.Rational
-	 * @param    {number} arg - Integer number.
-	 * @desc     Raise this Rational object to the power given.
-	 * @returns  {object} New Rational object.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @param    {string} op - The operation, one of 'add', 'sub', 'mul', 'div' or 'compare'.
+	 * @param    {Array}  arrays - The typed arrays of the operands followed by those of the results.
+	 * @desc     Applies an operation elementwise to typed arrays, exactly by BigInt arithmetic.
+	 * @throws   {TypeError} If invalid argument type is used, a denominator is zero, or a divisor is zero.
+	 * @throws   {RangeError} If a result does not fit the element type.
 	 */
-	pow(arg){
-		switch(arguments.length){
-			case 1:
-				arg = this._validate(arg);
+	static _batchArrays(op, arrays){
+		const kinds = [Int32Array, BigInt64Array, Float64Array];
+		const kind = kinds.find((k) => arrays[0] instanceof k);
 
-				let r = new Rational(1);
-				for(let i = 0; i < Math.abs(arg); i++){
-					r = r.selfMul(this);
+		const valid = kind && arrays.every((a, i) =>
+			(op === 'compare' && i === 4 ? a instanceof Int32Array : a instanceof kind) && a.length === arrays[0].length
+		);
+
+		if(!valid){
+			throw TypeError(`Rational: invalid argument`);
+		}
+
+		const [an, ad, bn, bd] = arrays;
+		const isInteger = (v) => kind !== Float64Array || (Number.isInteger(v) && Math.abs(v) < 2 ** 63);
+
+		for(let i = 0; i < an.length; i++){
+			if(![an[i], ad[i], bn[i], bd[i]].every(isInteger) || ad[i] < 0 || bd[i] < 0){
+				throw TypeError(`Rational: invalid argument`);
+			}
+			if(ad[i] == 0 || bd[i] == 0){
+				throw TypeError(`Rational: bad rational, zero denominator`);
+			}
+			if(op === 'div' && bn[i] == 0){
+				throw TypeError(`Rational: division by zero`);
+			}
+		}
+
+		const limit = kind === Int32Array ? [-(2n ** 31n), 2n ** 31n - 1n] :
+		              kind === BigInt64Array ? [-(2n ** 63n), 2n ** 63n - 1n] : [-(2n ** 53n - 1n), 2n ** 53n - 1n];
+
+		const gcd = (a, b) => b === 0n ? a : gcd(b, a % b);
+
+		for(let i = 0; i < an.length; i++){
+			const [xn, xd, yn, yd] = [an[i], ad[i], bn[i], bd[i]].map(BigInt);
+
+			if(op === 'compare'){
+				const d = xn * yd - yn * xd;
+				arrays[4][i] = d < 0n ? -1 : d > 0n ? 1 : 0;
+				continue;
+			}
+
+			let [n, d] = op === 'add' ? [xn * yd + yn * xd, xd * yd] :
+			             op === 'sub' ? [xn * yd - yn * xd, xd * yd] :
+			             op === 'mul' ? [xn * yn, xd * yd] : [xn * yd, xd * yn];
+
+			if(d < 0n){
+				[n, d] = [-n, -d];
+			}
+
+			const g = gcd(n < 0n ? -n : n, d);
+			[n, d] = [n / g, d / g];
+
+			if(n < limit[0] || n > limit[1] || d > limit[1]){
+				throw RangeError(`Rational: arithmetic overflow`);
+			}
+
+			arrays[4][i] = kind === BigInt64Array ? n : Number(n);
+			arrays[5][i] = kind === BigInt64Array ? d : Number(d);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number|string} arg1 - [Optional] Rational object, numerator, or a string of the form "n/d".
+	 * @param    {string} arg2 - [Optional] denominator.
+	 * @desc     Constructs a new Rational object.
+	 * @throws   {TypeError} If more than two arguments are given, or invalid argument type is used.
+	 */
+	constructor(arg1, arg2){
+		switch(arguments.length){
+			case 0:
+				this.den = 1;
+				this.num = 0;
+				break;
+			case 1:
+				arg1 = Rational._exact(arg1);
+
+				if(typeof arg1 === 'object' && arg1 instanceof Rational){
+					this.den = arg1.getDenominator();
+					this.num = arg1.getNumerator();
 				}
-				if(arg < 0){
-					r = (new Rational(1)).selfDiv(r);
+				else{
+					this.den = 1;
+					this.num = this._validate(arg1);
+				}
+				break;
+			case 2:
+				if(Rational._exact(arg1) !== arg1 || Rational._exact(arg2) !== arg2){
+					[this.num, this.den] = Rational._quotient(arg1, arg2);
+					break;
+				}
+
+				this.den = this._validate(arg2);
+				this.num = this._validate(arg1);
+				this._normalize();
+				break;
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+
+		Object.defineProperty(this, 'den', { enumerable: false });
+		Object.defineProperty(this, 'num', { enumerable: false });
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {any} arg - The argument to be validated as a numerator or denominator.
+	 * @returns  {number} An integer number.
+	 * @desc     Validates the given argument to be used as a numerator or denominator.
+	 * @throws   {TypeError} If the given argument is an invalid numerator or denominator.
+	 * @throws   {RangeError} If the given argument is out of the 64-bit range.
+	 */
+	_validate(arg){
+		if(typeof arg === 'number' && !Number.isNaN(arg)){
+			if(!(Math.abs(arg) < 2 ** 63))
+				throw RangeError('Rational: arithmetic overflow');
+
+			return Math.trunc(arg);
+		}
+		else
+		if(typeof arg === 'string'){
+			const r = Rational._parse(arg);
+
+			if(r.den !== 1)
+				throw TypeError(`Rational: invalid argument`);
+
+			return r.num;
+		}
+		else
+		if(typeof arg === 'bigint'){
+			if(arg < -(2n ** 63n) || arg >= 2n ** 63n)
+				throw RangeError('Rational: arithmetic overflow');
+
+			return Number(arg);
+		}
+		else{
+			throw TypeError(`Rational: invalid argument`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {any} arg - The argument to be validated as an integer.
+	 * @returns  {number} An integer number.
+	 * @desc     Validates the given argument as _validate does, rejecting a fractional number instead of truncating it.
+	 * @throws   {TypeError} If the given argument is a fractional number or otherwise invalid.
+	 * @throws   {RangeError} If the given argument is out of the 64-bit range.
+	 */
+	_integral(arg){
+		if(typeof arg === 'number' && Number.isFinite(arg) && !Number.isInteger(arg)){
+			throw TypeError(`Rational: invalid argument`);
+		}
+		return this._validate(arg);
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Normalizes the rational number i.e. no common factors and denominator is positive.
+	 * @throws   {TypeError} In case of zero denominator.
+	 */
+	_normalize(){
+		if(this.den === 0){
+			throw TypeError('Rational: bad rational, zero denominator');
+		}
+		else
+		if(this.num === 0){
+			this.den = 1;
+		}
+		else{
+			let g = Math.abs( Rational.gcd(this.num, this.den) );
+
+			this.num /= g;
+			this.den /= g;
+
+			if(this.den < 0){
+				this.num = -this.num;
+				this.den = -this.den;
+			}
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Checks this Rational object may be changed.
+	 * @throws   {TypeError} If this Rational object is frozen, as a constant or a cached result.
+	 */
+	_mutable(){
+		if(Object.isFrozen(this)){
+			throw TypeError('Rational: immutable rational');
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     An accessor function to return the numerator.
+	 * @returns  {number} The numerator.
+	 */
+	getNumerator(){ return this.num; }
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     An accessor function to return the denominator.
+	 * @returns  {number} The denominator.
+	 */
+	getDenominator(){ return this.den; }
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg1 - [Optional] Rational object or numerator.
+	 * @param    {string} arg2 - [Optional] denominator.
+	 * @desc     Assignment to this Rational object.
+	 * @throws   {TypeError} If neither of one or two arguments are given, or invalid argument type is used.
+	 */
+	assign(arg1, arg2){
+		this._mutable();
+
+		switch(arguments.length){
+			case 1:
+				arg1 = Rational._exact(arg1);
+
+				if(typeof arg1 === 'object' && arg1 instanceof Rational){
+					this.num = arg1.getNumerator();
+					this.den = arg1.getDenominator();
+				}
+				else{
+					this.num = this._validate(arg1);
+					this.den = 1;
+				}
+				break;
+			case 2:
+				if(Rational._exact(arg1) !== arg1 || Rational._exact(arg2) !== arg2){
+					[this.num, this.den] = Rational._quotient(arg1, arg2);
+					break;
+				}
+
+				this.num = this._validate(arg1);
+				this.den = this._validate(arg2);
+				this._normalize();
+				break;
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Adds to this Rational object another Rational object or an integer value.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	selfAdd(arg){
+		this._mutable();
+
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					let r_num = arg.getNumerator();
+					let r_den = arg.getDenominator();
+
+					let g = Rational.gcd(this.den, r_den);
+
+					this.den /= g;
+					this.num = this.num * (r_den / g) + r_num * this.den;
+
+					g = Math.abs( Rational.gcd(this.num, g) );
+					this.num /= g;
+					this.den *= (r_den/g);
+				}
+				else{
+					arg = this._validate(arg);
+					this.num += arg * this.den;
+				}
+				return this;
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Subtracts from this Rational object another Rational object or an integer value.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	selfSub(arg){
+		this._mutable();
+
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					let r_num = arg.getNumerator();
+					let r_den = arg.getDenominator();
+
+					let g = Rational.gcd(this.den, r_den);
+
+					this.den /= g;
+					this.num = this.num * (r_den / g) - r_num * this.den;
+
+					g = Math.abs( Rational.gcd(this.num, g) );
+					this.num /= g;
+					this.den *= (r_den/g);
+				}
+				else{
+					arg = this._validate(arg);
+					this.num -= arg * this.den;
+				}
+				return this;
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Multiplies this Rational object by another Rational object or an integer value.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	selfMul(arg){
+		this._mutable();
+
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					let r_num = arg.getNumerator();
+					let r_den = arg.getDenominator();
+
+					let gcd1 = Math.abs( Rational.gcd(this.num, r_den) );
+					let gcd2 = Math.abs( Rational.gcd(r_num, this.den) );
+
+					this.num = (this.num/gcd1) * (r_num/gcd2);
+					this.den = (this.den/gcd2) * (r_den/gcd1);
+				}
+				else{
+					arg = this._validate(arg);
+
+					let gcd = Math.abs( Rational.gcd( arg, this.den ) );
+					this.num *= arg / gcd;
+					this.den /= gcd;
+				}
+				return this;
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Divides this Rational object by another Rational object or an integer value.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	selfDiv(arg){
+		this._mutable();
+
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+
+					let r_num = arg.getNumerator();
+					let r_den = arg.getDenominator();
+
+					if(r_num === 0){
+						throw TypeError(`Rational: division by zero`);
+					}
+
+					if(this.num === 0) return this;
+
+					let gcd1 = Math.abs( Rational.gcd(this.num, r_num) );
+					let gcd2 = Math.abs( Rational.gcd(r_den, this.den) );
+
+					this.num = (this.num/gcd1) * (r_den/gcd2);
+					this.den = (this.den/gcd2) * (r_num/gcd1);
+
+					if(this.den < 0){
+						this.num = -this.num;
+						this.den = -this.den;
+					}
+				}
+				else{
+					arg = this._validate(arg);
+
+					if(arg === 0){
+						throw TypeError(`Rational: division by zero`);
+					}
+
+ 					if(this.num == 0) return this;
+
+					let gcd = Math.abs( Rational.gcd(this.num, arg) );
+					this.num = this.num / gcd;
+					this.den *= (arg / gcd);
+
+					if(this.den < 0){
+						this.num = -this.num;
+						this.den = -this.den;
+					}
+				}
+				return this;
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {number} arg - Integer number.
+	 * @desc     Raise this Rational object to the power given.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	selfPow(arg){
+		this._mutable();
+
+		switch(arguments.length){
+			case 1:
+				arg = this._integral(arg);
+
+				let r = new Rational(1);
+				let b = new Rational(this);
+				for(let n = Math.abs(arg); n > 0; n = Math.floor(n / 2)){
+					if(n % 2){
+						r = r.selfMul(b);
+					}
+					if(n > 1){
+						b = b.mul(b);
+					}
+				}
+				if(arg < 0){
+					r = (new Rational(1)).selfDiv(r);
+				}
+
+				this.num = r.getNumerator();
+				this.den = r.getDenominator();
+				return this;
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Adds this Rational object to another Rational object or an integer value.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	add(arg){
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				let _num = this.num;
+				let _den = this.den;
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					let r_num = arg.getNumerator();
+					let r_den = arg.getDenominator();
+
+					let g = Rational.gcd(_den, r_den);
+
+					_den /= g;
+					_num = _num * (r_den / g) + r_num * _den;
+
+					g = Math.abs( Rational.gcd(_num, g) );
+					_num /= g;
+					_den *= (r_den/g);
+				}
+				else{
+					arg = this._validate(arg);
+					_num += arg * _den;
+				}
+				return Rational._result(_num, _den);
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Subtracts from this Rational object another Rational object or an integer value.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	sub(arg){
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				let _num = this.num;
+				let _den = this.den;
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					let r_num = arg.getNumerator();
+					let r_den = arg.getDenominator();
+
+					let g = Rational.gcd(_den, r_den);
+
+					_den /= g;
+					_num = _num * (r_den / g) - r_num * _den;
+
+					g = Math.abs( Rational.gcd(_num, g) );
+					_num /= g;
+					_den *= (r_den/g);
+				}
+				else{
+					arg = this._validate(arg);
+					_num -= arg * _den;
+				}
+				return Rational._result(_num, _den);
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Multiplies this Rational object by another Rational object or an integer value.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	mul(arg){
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				let _num = this.num;
+				let _den = this.den;
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					let r_num = arg.getNumerator();
+					let r_den = arg.getDenominator();
+
+					let gcd1 = Math.abs( Rational.gcd(_num, r_den) );
+					let gcd2 = Math.abs( Rational.gcd(r_num, _den) );
+
+					_num = (_num/gcd1) * (r_num/gcd2);
+					_den = (_den/gcd2) * (r_den/gcd1);
+				}
+				else{
+					arg = this._validate(arg);
+
+					let gcd = Math.abs( Rational.gcd( arg, _den ) );
+					_num *= arg / gcd;
+					_den /= gcd;
+				}
+				return Rational._result(_num, _den);
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Divides this Rational object by another Rational object or an integer value.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	div(arg){
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				let _num = this.num;
+				let _den = this.den;
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+
+					let r_num = arg.getNumerator();
+					let r_den = arg.getDenominator();
+
+					if(r_num === 0){
+						throw TypeError(`Rational: division by zero`);
+					}
+
+					if(_num === 0) return Rational._result(_num, _den);
+
+					let gcd1 = Math.abs( Rational.gcd(_num, r_num) );
+					let gcd2 = Math.abs( Rational.gcd(r_den, _den) );
+
+					_num = (_num/gcd1) * (r_den/gcd2);
+					_den = (_den/gcd2) * (r_num/gcd1);
+
+					if(_den < 0){
+						_num = -_num;
+						_den = -_den;
+					}
+				}
+				else{
+					arg = this._validate(arg);
+
+					if(arg === 0){
+						throw TypeError(`Rational: division by zero`);
+					}
+
+ 					if(_num == 0) return this;
+
+					let gcd = Math.abs( Rational.gcd(_num, arg) );
+					_num = _num / gcd;
+					_den *= (arg / gcd);
+
+					if(_den < 0){
+						_num = -_num;
+						_den = -_den;
+					}
+				}
+				return Rational._result(_num, _den);
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {number} arg - Integer number.
+	 * @desc     Raise this Rational object to the power given.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	pow(arg){
+		switch(arguments.length){
+			case 1:
+				arg = this._integral(arg);
+
+				let r = new Rational(1);
+				let b = new Rational(this);
+				for(let n = Math.abs(arg); n > 0; n = Math.floor(n / 2)){
+					if(n % 2){
+						r = r.selfMul(b);
+					}
+					if(n > 1){
+						b = b.mul(b);
+					}
+				}
+				if(arg < 0){
+					r = (new Rational(1)).selfDiv(r);
+				}
+
+				return Rational._result(r.getNumerator(), r.getDenominator());
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Increment and return this Rational object.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	preInc(){
+		this._mutable();
+
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		this.num += this.den;
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Decrement and return this Rational object.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	preDec(){
+		this._mutable();
+
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		this.num -= this.den;
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Return this Rational object, then increment it.
+	 * @returns  {object} Copy of this Rational object before increment.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	postInc(){
+		this._mutable();
+
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		let t = new Rational(this);
+		this.num += this.den;
+		return t;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Return this Rational object, then decrement it.
+	 * @returns  {object} Copy of this Rational object before decrement.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	postDec(){
+		this._mutable();
+
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		let t = new Rational(this);
+		this.num -= this.den;
+		return t;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Set this Rational object to its absolute value.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	selfAbs(){
+		this._mutable();
+
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(this.num < 0) this.num = -this.num;
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Negate this Rational object sign.
+	 * @returns  {object} The Rational object denoted by this.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	selfNeg(){
+		this._mutable();
+
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(this.num !== 0) this.num = -this.num;
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Returns absolute value of Rational object.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	abs(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(this.num < 0) return Rational._result(-this.num, this.den);
+		return Rational._result(this.num, this.den);
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Returns negate of this Rational object sign.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	neg(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(this.num !== 0) return Rational._result(-this.num, this.den);
+		return Rational._result(this.num, this.den);
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {number} bound - The largest denominator.
+	 * @desc     Returns the closest rational to this Rational object with a denominator up to the bound.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If other than one argument is given, or the bound is not an integer of at least 1.
+	 */
+	limitDenominator(bound){
+		if(arguments.length !== 1){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+
+		const [num, den] = Rational._limit(BigInt(this.num), BigInt(this.den), Rational._bound(bound));
+		return Rational._result(num, den);
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Returns true if this Rational object is zero, false otherwise.
+	 * @returns  {boolean} True if this Rational object is zero, false otherwise.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	not(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		return !this.num;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Returns true if this Rational object is not zero, false otherwise.
+	 * @returns  {boolean} True if this Rational object is not zero, false otherwise.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	bool(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		return !!this.num;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Compare this Rational object to the given argument.
+	 * @returns  {boolean} True if this Rational object is less than the given argument.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	lessThan(arg){
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+
+					let ts = {
+						n: this.num,
+						d: this.den,
+						q: Math.trunc(this.num / this.den),
+						r: this.num % this.den
+					};
+
+					let rs = {
+						n: arg.getNumerator(),
+						d: arg.getDenominator(),
+						q: Math.trunc(arg.getNumerator() / arg.getDenominator()),
+						r: arg.getNumerator() % arg.getDenominator()
+					};
+
+					while (ts.r < 0){ ts.r += ts.d; --ts.q; }
+					while (rs.r < 0){ rs.r += rs.d; --rs.q; }
+
+					let reverse = 0x0;
+
+					for( ;; ){
+						if(ts.q !== rs.q){
+							return reverse ? ts.q > rs.q : ts.q < rs.q;
+						}
+
+						reverse ^= 0x1;
+
+						if(ts.r === 0 || rs.r === 0) break;
+
+						ts.n = ts.d;         ts.d = ts.r;
+						ts.q = Math.trunc(ts.n / ts.d);  ts.r = ts.n % ts.d;
+						rs.n = rs.d;         rs.d = rs.r;
+						rs.q = Math.trunc(rs.n / rs.d);  rs.r = rs.n % rs.d;
+					}
+
+					if(ts.r === rs.r)
+						return false;
+					else
+						return ( ts.r !== 0 ) !== ( !!reverse );
+				}
+				else{
+					arg = this._validate(arg);
+
+					let q = Math.trunc(this.num / this.den);
+					let r = this.num % this.den;
+
+					while(r < 0){ r += this.den; --q; }
+
+					return q < arg;
+				}
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Compare this Rational object to the given argument.
+	 * @returns  {boolean} True if this Rational object is greater than the given argument.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	greaterThan(arg){
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					return !(this.lessThan(arg) || this.equalTo(arg));
+				}
+				else{
+					arg = this._validate(arg);
+					return !(this.lessThan(arg) || this.equalTo(arg));
+				}
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Compare this Rational object to the given argument.
+	 * @returns  {boolean} True if this Rational object is equal to the given argument.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	equalTo(arg){
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					return this.num === arg.getNumerator() && this.den === arg.getDenominator();
+				}
+				else{
+					arg = this._validate(arg);
+					return this.num === arg && this.den === 1;
+				}
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Compare this Rational object to the given argument.
+	 * @returns  {boolean} True if this Rational object is not equal to the given argument.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	notEqualTo(arg){
+		switch(arguments.length){
+			case 1:
+				arg = Rational._exact(arg);
+
+				if(typeof arg === 'object' && arg instanceof Rational){
+					return !this.equalTo(arg);
+				}
+				else{
+					arg = this._validate(arg);
+					return !this.equalTo(arg);
+				}
+			default:
+				throw TypeError(`Rational: invalid number of arguments`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Returns this Rational object converted to a real number.
+	 * @returns  {number} Real number.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	valueOf(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		return this.num / this.den;
+	}
+
+	toString(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		return `${this.num < 0 ? '-' : ''}${Math.abs(this.num)}/${this.den}`;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {number} digits - [Optional] The number of fraction digits, 0 to 100, 0 by default.
+	 * @param    {string} mode - [Optional] The rounding mode, 'halfEven' by default.
+	 * @desc     Returns this Rational object as a decimal with the given number of fraction digits.
+	 * @returns  {string} The decimal representation.
+	 * @throws   {TypeError} If more than two arguments are given, or invalid argument type is used.
+	 */
+	toFixed(digits = 0, mode = 'halfEven'){
+		if(arguments.length > 2){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+
+		digits = this._integral(digits);
+		if(digits < 0 || digits > 100){
+			throw TypeError(`Rational: invalid argument`);
+		}
+
+		const s = Rational._round(BigInt(this.num) * 10n ** BigInt(digits), BigInt(this.den), mode);
+		const m = (s < 0n ? -s : s).toString().padStart(digits + 1, '0');
+
+		return `${s < 0n ? '-' : ''}${m.slice(0, m.length - digits)}${digits ? '.' : ''}${m.slice(m.length - digits)}`;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {object} options - [Optional] The options maxDigits, the number of fraction digits 0 to 1000,
+	 *                              100 by default, and repeat, whether to enclose the period in parentheses,
+	 *                              true by default.
+	 * @desc     Returns the decimal expansion of this Rational object, exact or truncated with an ellipsis.
+	 * @returns  {string} The decimal expansion.
+	 * @throws   {TypeError} If more than one argument is given, or invalid argument type is used.
+	 */
+	toDecimalString(options = {}){
+		if(arguments.length > 1){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		if(typeof options !== 'object' || options === null){
+			throw TypeError(`Rational: invalid argument`);
+		}
+
+		let { maxDigits = 100, repeat = true } = options;
+
+		maxDigits = this._integral(maxDigits);
+		if(maxDigits < 0 || maxDigits > 1000 || typeof repeat !== 'boolean'){
+			throw TypeError(`Rational: invalid argument`);
+		}
+
+		const b = BigInt(this.den);
+		const a = BigInt(Math.abs(this.num));
+
+		let str = `${this.num < 0 ? '-' : ''}${a / b}`;
+		let rem = a % b;
+
+		if(rem === 0n) return str;
+
+		/* The period starts after as many digits as the larger power of 2 or 5 dividing the denominator. */
+		let twos = 0, fives = 0;
+
+		for(let d = b; d % 2n === 0n; d /= 2n) twos++;
+		for(let d = b; d % 5n === 0n; d /= 5n) fives++;
+
+		const prefix = Math.max(twos, fives);
+
+		let digits = '', start = -1n;
+
+		for(let i = 0; i < maxDigits && rem !== 0n; i++){
+			if(repeat && i === prefix) start = rem;
+
+			digits += (rem * 10n / b).toString();
+			rem = rem * 10n % b;
+
+			if(rem === start){
+				return `${str}.${digits.slice(0, prefix)}(${digits.slice(prefix)})`;
+			}
+		}
+
+		if(rem === 0n) return `${str}.${digits}`;
+
+		return `${str}${digits ? '.' : ''}${digits}...`;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Returns the largest integer not greater than this Rational object.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	floor(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		return Rational._result(Number(Rational._round(BigInt(this.num), BigInt(this.den), 'floor')), 1);
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @desc     Returns the smallest integer not less than this Rational object.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	ceil(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		return Rational._result(Number(Rational._round(BigInt(this.num), BigInt(this.den), 'ceil')), 1);
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Rational
+	 * @param    {string} mode - [Optional] The rounding mode, 'halfEven' by default.
+	 * @desc     Returns this Rational object rounded to an integer in the given mode.
+	 * @returns  {object} New Rational object.
+	 * @throws   {TypeError} If more than one argument is given, or invalid argument type is used.
+	 */
+	round(mode = 'halfEven'){
+		if(arguments.length > 1){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		return Rational._result(Number(Rational._round(BigInt(this.num), BigInt(this.den), mode)), 1);
+	}
+
+	/**
+	 * @method
+	 * @static
+	 * @private
+	 * @memberof module:rational-module.Rational
+	 * @param    {bigint} num - Numerator.
+	 * @param    {bigint} den - Positive denominator.
+	 * @param    {string} mode - The rounding mode, one of those of Intl.NumberFormat.
+	 * @returns  {bigint} The integer num/den rounded in the given mode.
+	 * @desc     Rounds a quotient by integer division.
+	 * @throws   {TypeError} If the rounding mode is invalid.
+	 */
+	static _round(num, den, mode){
+		const away = {
+			floor:      (sign, half, odd) => sign < 0,
+			ceil:       (sign, half, odd) => sign > 0,
+			trunc:      (sign, half, odd) => false,
+			expand:     (sign, half, odd) => true,
+			halfFloor:  (sign, half, odd) => half > 0 || (half === 0 && sign < 0),
+			halfCeil:   (sign, half, odd) => half > 0 || (half === 0 && sign > 0),
+			halfTrunc:  (sign, half, odd) => half > 0,
+			halfExpand: (sign, half, odd) => half >= 0,
+			halfEven:   (sign, half, odd) => half > 0 || (half === 0 && odd)
+		};
+
+		if(typeof mode !== 'string' || !Object.hasOwn(away, mode)){
+			throw TypeError(`Rational: invalid argument`);
+		}
+
+		const q = num / den, m = num % den;
+		if(m === 0n) return q;
+
+		const a = m < 0n ? -m : m;
+		const sign = m < 0n ? -1 : 1;
+		const half = a < den - a ? -1 : den - a < a ? 1 : 0;
+
+		return away[mode](sign, half, q % 2n !== 0n) ? q + BigInt(sign) : q;
+	}
+}
+
+/* Frozen constants of the Rational class, also reused by the cache of small rationals. */
+for(const [name, num, den] of [['ZERO', 0, 1], ['ONE', 1, 1], ['TWO', 2, 1], ['MINUS_ONE', -1, 1], ['HALF', 1, 2]]){
+	Object.defineProperty(Rational, name, { value: Object.freeze(new Rational(num, den)), enumerable: true });
+}
+
+Rational._cache = new Map();
+Rational._cacheBound = 0;
+
+/**
+ * @class  Accumulator
+ * @static
+ * @desc   A class for accumulating sums and products of rational numbers.
+ */
+class Accumulator{
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Accumulator
+	 * @param    {object|number} arg - [Optional] Rational object or number as the initial value.
+	 * @desc     Constructs a new Accumulator object.
+	 * @throws   {TypeError} If more than one argument is given, or invalid argument type is used.
+	 */
+	constructor(arg){
+		if(arguments.length > 1){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		this.acc = arguments.length ? new Rational(arg) : new Rational();
+
+		Object.defineProperty(this, 'acc', { enumerable: false });
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Accumulator
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Adds to this Accumulator object a Rational object or an integer value.
+	 * @returns  {object} The Accumulator object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	add(arg){
+		this.acc.selfAdd(...arguments);
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Accumulator
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Subtracts from this Accumulator object a Rational object or an integer value.
+	 * @returns  {object} The Accumulator object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	sub(arg){
+		this.acc.selfSub(...arguments);
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Accumulator
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Multiplies this Accumulator object by a Rational object or an integer value.
+	 * @returns  {object} The Accumulator object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 */
+	mul(arg){
+		this.acc.selfMul(...arguments);
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Accumulator
+	 * @param    {object|number} arg - Rational object or number.
+	 * @desc     Divides this Accumulator object by a Rational object or an integer value.
+	 * @returns  {object} The Accumulator object denoted by this.
+	 * @throws   {TypeError} If other than one arguments is given, invalid argument type is used, or division by zero.
+	 */
+	div(arg){
+		this.acc.selfDiv(...arguments);
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Accumulator
+	 * @desc     Returns the accumulated value.
+	 * @returns  {object} A new Rational object.
+	 * @throws   {TypeError} If an argument was given.
+	 */
+	value(){
+		if(arguments.length > 0){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		return new Rational(this.acc);
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.Accumulator
+	 * @param    {object|number} arg - [Optional] Rational object or number as the new value.
+	 * @desc     Restarts the accumulation from the given value or zero.
+	 * @returns  {object} The Accumulator object denoted by this.
+	 * @throws   {TypeError} If more than one argument is given, or invalid argument type is used.
+	 */
+	reset(arg){
+		if(arguments.length > 1){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		this.acc = arguments.length ? new Rational(arg) : new Rational();
+		return this;
+	}
+}
+
+/**
+ * @class  BigRational
+ * @static
+ * @desc   A class for representing and manipulating rational numbers of BigInt integers.
+ */
+class BigRational{
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg1 - [Optional] BigRational, Rational, numeric string or numerator.
+	 * @param    {number|bigint} arg2 - [Optional] denominator.
+	 * @desc     Constructs a new BigRational object.
+	 * @throws   {TypeError} If more than two arguments are given, invalid argument type is used, or zero denominator.
+	 */
+	constructor(arg1, arg2){
+		if(arguments.length > 2){
+			throw TypeError(`Rational: invalid number of arguments`);
+		}
+		this.num = 0n;
+		this.den = 1n;
+
+		if(arguments.length)
+			this.assign(...arguments);
+
+		Object.defineProperty(this, 'den', { enumerable: false });
+		Object.defineProperty(this, 'num', { enumerable: false });
+	}
+
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - The argument to be validated as an integer.
+	 * @returns  {bigint} An integer.
+	 * @desc     Validates the given number or BigInt to be used as an integer.
+	 * @throws   {TypeError} If the given argument is neither an integral number nor a BigInt.
+	 */
+	static _validate(arg){
+		if(typeof arg === 'number' && Number.isInteger(arg)){
+			return BigInt(arg);
+		}
+		else
+		if(typeof arg === 'bigint'){
+			return arg;
+		}
+		else{
+			throw TypeError(`Rational: invalid argument`);
+		}
+	}
+
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.BigRational
+	 * @param    {bigint} num - The numerator.
+	 * @param    {bigint} den - The denominator.
+	 * @returns  {object} A new BigRational object.
+	 * @desc     Creates a normalized BigRational object of the given numerator and denominator.
+	 * @throws   {TypeError} In case of zero denominator.
+	 */
+	static _make(num, den){
+		if(den === 0n){
+			throw TypeError('Rational: bad rational, zero denominator');
+		}
+
+		let a = num < 0n ? -num : num, b = den < 0n ? -den : den;
+		while(b){
+			[a, b] = [b, a % b];
+		}
+
+		let r = new BigRational();
+		r.num = den < 0n ? -num / a : num / a;
+		r.den = den < 0n ? -den / a : den / a;
+		return r;
+	}
+
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} A BigRational object.
+	 * @desc     Converts the given argument into a BigRational object.
+	 * @throws   {TypeError} If invalid argument type is used, or zero denominator.
+	 */
+	static _from(arg){
+		if(arg instanceof BigRational){
+			return arg;
+		}
+		else
+		if(arg instanceof Rational){
+			return BigRational._make(BigInt(arg.getNumerator()), BigInt(arg.getDenominator()));
+		}
+		else
+		if(typeof arg === 'string'){
+			const match = /^([+-]?\d+)(?:\/([+-]?\d+))?$/.exec(arg);
+			if(!match){
+				throw TypeError(`Rational: invalid argument`);
+			}
+
+			const num = BigInt(match[1]), den = BigInt(match[2] ?? 1);
+			if(den === 0n){
+				throw TypeError('Rational: bad rational, zero denominator');
+			}
+
+			return BigRational._make(num, den);
+		}
+		else{
+			return BigRational._exact(arg);
+		}
+	}
+
+	/**
+	 * @method
+	 * @static
+	 * @memberof module:rational-module.BigRational
+	 * @param    {number|bigint} arg - A number, taken as the exact value of the double, or a BigInt.
+	 * @returns  {object} A new BigRational object.
+	 * @desc     Converts a finite non-integer number into the dyadic rational it holds, doubling it until integral.
+	 * @throws   {TypeError} If the given argument is neither a finite number nor a BigInt.
+	 */
+	static _exact(arg){
+		if(typeof arg !== 'number' || !Number.isFinite(arg) || Number.isInteger(arg)){
+			return BigRational._make(BigRational._validate(arg), 1n);
+		}
+
+		let den = 1n;
+		for( ; !Number.isInteger(arg); den *= 2n) arg *= 2;
+
+		return BigRational._make(BigInt(arg), den);
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.BigRational
+	 * @returns  {bigint} The numerator.
+	 * @desc     Returns the numerator of this BigRational object.
+	 */
+	getNumerator(){
+		return this.num;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.BigRational
+	 * @returns  {bigint} The denominator.
+	 * @desc     Returns the denominator of this BigRational object.
+	 */
+	getDenominator(){
+		return this.den;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg1 - BigRational, Rational, numeric string or numerator.
+	 * @param    {number|bigint} arg2 - [Optional] denominator.
+	 * @desc     Assignment to this BigRational object.
+	 * @throws   {TypeError} If neither of one or two arguments are given, or invalid argument type is used.
+	 */
+	assign(arg1, arg2){
+		let r;
+		switch(arguments.length){
+			case 1:
+				r = BigRational._from(arg1);
+				break;
+			case 2:
+				r = BigRational._exact(arg2);
+				if(r.num === 0n){
+					throw TypeError('Rational: bad rational, zero denominator');
 				}
 
-				return new Rational(r.getNumerator(), r.getDenominator());
+				r = BigRational._exact(arg1).div(r);
+				break;
 			default:
 				throw TypeError(`Rational: invalid number of arguments`);
 		}
+		this.num = r.num;
+		this.den = r.den;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Increment and return this Rational object.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If an argument was given.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} A new BigRational object, the sum.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
 	 */
-	preInc(){
-		if(arguments.length > 0){
+	add(arg){
+		if(arguments.length !== 1){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		this.num += this.den;
-		return this;
+		const r = BigRational._from(arg);
+		return BigRational._make(this.num * r.den + r.num * this.den, this.den * r.den);
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Decrement and return this Rational object.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If an argument was given.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} A new BigRational object, the difference.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
 	 */
-	preDec(){
-		if(arguments.length > 0){
+	sub(arg){
+		if(arguments.length !== 1){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		this.num -= this.den;
-		return this;
+		const r = BigRational._from(arg);
+		return BigRational._make(this.num * r.den - r.num * this.den, this.den * r.den);
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Return this Rational object, then increment it.
-	 * @returns  {object} Copy of this Rational object before increment.
-	 * @throws   {TypeError} If an argument was given.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} A new BigRational object, the product.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
 	 */
-	postInc(){
-		if(arguments.length > 0){
+	mul(arg){
+		if(arguments.length !== 1){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		let t = new Rational(this);
-		this.num += this.den;
-		return t;
+		const r = BigRational._from(arg);
+		return BigRational._make(this.num * r.num, this.den * r.den);
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Return this Rational object, then decrement it.
-	 * @returns  {object} Copy of this Rational object before decrement.
-	 * @throws   {TypeError} If an argument was given.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} A new BigRational object, the quotient.
+	 * @throws   {TypeError} If other than one arguments is given, invalid argument type is used, or division by zero.
 	 */
-	postDec(){
-		if(arguments.length > 0){
+	div(arg){
+		if(arguments.length !== 1){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		let t = new Rational(this);
-		this.num -= this.den;
-		return t;
+		const r = BigRational._from(arg);
+		if(r.num === 0n){
+			throw TypeError(`Rational: division by zero`);
+		}
+		return BigRational._make(this.num * r.den, this.den * r.num);
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Set this Rational object to its absolute value.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If an argument was given.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {number|bigint} arg - The integer exponent.
+	 * @returns  {object} A new BigRational object, the power.
+	 * @throws   {TypeError} If other than one arguments is given, invalid argument type is used, or division by zero.
+	 * @throws   {RangeError} If a term of the result exceeds 2^18 bits, bounding the time of a single call.
 	 */
-	selfAbs(){
-		if(arguments.length > 0){
+	pow(arg){
+		if(arguments.length !== 1){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		if(this.num < 0) this.num = -this.num;
+		if(typeof arg !== 'number' && typeof arg !== 'bigint' || Number.isFinite(arg) && !Number.isInteger(arg)){
+			throw TypeError(`Rational: invalid argument`);
+		}
+
+		let n = new Rational()._validate(arg);
+		if(n < 0 && this.num === 0n){
+			throw TypeError(`Rational: division by zero`);
+		}
+
+		/* Base 2 logarithm of a magnitude, as its bit length beyond the range of numbers. */
+		const log2 = (x) => Number.isFinite(Number(x)) ? Math.log2(Math.abs(Number(x))) : x.toString(2).replace('-', '').length;
+
+		const bits = Math.max(log2(this.num), log2(this.den));
+		if(bits > 0 && Math.abs(n) * bits > 2 ** 18){
+			throw RangeError('Rational: arithmetic overflow');
+		}
+
+		let r = new BigRational(1);
+		let b = n < 0 ? BigRational._make(this.den, this.num) : this;
+		for(n = Math.abs(n); n > 0; n = Math.floor(n / 2)){
+			if(n % 2){
+				r = r.mul(b);
+			}
+			if(n > 1){
+				b = b.mul(b);
+			}
+		}
+		return r;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} The BigRational object denoted by this.
+	 * @desc     Adds to this BigRational object the given value.
+	 */
+	selfAdd(arg){
+		this.assign(this.add(...arguments));
 		return this;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Negate this Rational object sign.
-	 * @returns  {object} The Rational object denoted by this.
-	 * @throws   {TypeError} If an argument was given.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} The BigRational object denoted by this.
+	 * @desc     Subtracts from this BigRational object the given value.
 	 */
-	selfNeg(){
-		if(arguments.length > 0){
-			throw TypeError(`Rational: invalid number of arguments`);
-		}
-		if(this.num !== 0) this.num = -this.num;
+	selfSub(arg){
+		this.assign(this.sub(...arguments));
 		return this;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Returns absolute value of Rational object.
-	 * @returns  {object} New Rational object.
-	 * @throws   {TypeError} If an argument was given.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} The BigRational object denoted by this.
+	 * @desc     Multiplies this BigRational object by the given value.
 	 */
-	abs(){
-		if(arguments.length > 0){
-			throw TypeError(`Rational: invalid number of arguments`);
-		}
-		if(this.num < 0) return new Rational(-this.num, this.den);
-		return new Rational(this.num, this.den);;
+	selfMul(arg){
+		this.assign(this.mul(...arguments));
+		return this;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Returns negate of this Rational object sign.
-	 * @returns  {object} New Rational object.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {object} The BigRational object denoted by this.
+	 * @desc     Divides this BigRational object by the given value.
+	 */
+	selfDiv(arg){
+		this.assign(this.div(...arguments));
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.BigRational
+	 * @param    {number|bigint} arg - The integer exponent.
+	 * @returns  {object} The BigRational object denoted by this.
+	 * @desc     Raises this BigRational object to the given power.
+	 */
+	selfPow(arg){
+		this.assign(this.pow(...arguments));
+		return this;
+	}
+
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.BigRational
+	 * @returns  {object} A new BigRational object, the negation.
 	 * @throws   {TypeError} If an argument was given.
 	 */
 	neg(){
 		if(arguments.length > 0){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		if(this.num !== 0) return new Rational(-this.num, this.den);
-		return new Rational(this.num, this.den);
+		return BigRational._make(-this.num, this.den);
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Returns true if this Rational object is zero, false otherwise.
-	 * @returns  {boolean} True if this Rational object is zero, false otherwise.
+	 * @memberof module:rational-module.BigRational
+	 * @returns  {object} A new BigRational object, the absolute value.
 	 * @throws   {TypeError} If an argument was given.
 	 */
-	not(){
+	abs(){
 		if(arguments.length > 0){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		return !this.num;
+		return BigRational._make(this.num < 0n ? -this.num : this.num, this.den);
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Returns true if this Rational object is not zero, false otherwise.
-	 * @returns  {boolean} True if this Rational object is not zero, false otherwise.
-	 * @throws   {TypeError} If an argument was given.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {number} -1, 0 or 1 as this BigRational object is less than, equal to or greater than the given value.
+	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
 	 */
-	bool(){
-		if(arguments.length > 0){
+	_compare(arg){
+		if(arguments.length !== 1){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		return !!this.num;
+		const r = BigRational._from(arg);
+		const a = this.num * r.den, b = r.num * this.den;
+		return a < b ? -1 : a > b ? 1 : 0;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Compare this Rational object to the given argument.
-	 * @returns  {boolean} True if this Rational object is less than the given argument.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {boolean} True if this BigRational object is less than the given value.
 	 */
 	lessThan(arg){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg === 'object' && arg instanceof Rational){
-
-					let ts = {
-						n: this.num,
-						d: this.den,
-						q: Math.trunc(this.num / this.den),
-						r: this.num % this.den
-					};
-
-					let rs = {
-						n: arg.getNumerator(),
-						d: arg.getDenominator(),
-						q: Math.trunc(arg.getNumerator() / arg.getDenominator()),
-						r: arg.getNumerator() % arg.getDenominator()
-					};
-
-					while (ts.r < 0){ ts.r += ts.d; --ts.q; }
-					while (rs.r < 0){ rs.r += rs.d; --rs.q; }
-
-					let reverse = 0x0;
-
-					for( ;; ){
-						if(ts.q !== rs.q){
-							return reverse ? ts.q > rs.q : ts.q < rs.q;
-						}
-
-						reverse ^= 0x1;
-
-						if(ts.r === 0 || rs.r === 0) break;
-
-						ts.n = ts.d;         ts.d = ts.r;
-						ts.q = Math.trunc(ts.n / ts.d);  ts.r = ts.n % ts.d;
-						rs.n = rs.d;         rs.d = rs.r;
-						rs.q = Math.trunc(rs.n / rs.d);  rs.r = rs.n % rs.d;
-					}
-
-					if(ts.r === rs.r)
-						return false;
-					else
-						return ( ts.r !== zero ) !== ( !!reverse );
-				}
-				else{
-					arg = this._validate(arg);
-
-					let q = Math.trunc(this.num / this.den);
-					let r = this.num % this.den;
-
-					while(r < 0){ r += this.den; --q; }
-
-					return q < arg;
-				}
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
-		}
+		return this._compare(...arguments) < 0;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Compare this Rational object to the given argument.
-	 * @returns  {boolean} True if this Rational object is greater than the given argument.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {boolean} True if this BigRational object is greater than the given value.
 	 */
 	greaterThan(arg){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg === 'object' && arg instanceof Rational){
-					return !(this.lessThan(arg) || this.equalTo(arg));
-				}
-				else{
-					arg = this._validate(arg);
-					return !(this.lessThan(arg) || this.equalTo(arg));
-				}
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
-		}
+		return this._compare(...arguments) > 0;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Compare this Rational object to the given argument.
-	 * @returns  {boolean} True if this Rational object is equal to the given argument.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {boolean} True if this BigRational object is equal to the given value.
 	 */
 	equalTo(arg){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg === 'object' && arg instanceof Rational){
-					return this.num === arg.getNumerator() && this.den === arg.getDenominator();
-				}
-				else{
-					arg = this._validate(arg);
-					return this.num === arg && this.den === 1;
-				}
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
-		}
+		return this._compare(...arguments) === 0;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @param    {object|number} arg - Rational object or integer number.
-	 * @desc     Compare this Rational object to the given argument.
-	 * @returns  {boolean} True if this Rational object is not equal to the given argument.
-	 * @throws   {TypeError} If other than one arguments is given, or invalid argument type is used.
+	 * @memberof module:rational-module.BigRational
+	 * @param    {any} arg - BigRational, Rational, numeric string or integer.
+	 * @returns  {boolean} True if this BigRational object is not equal to the given value.
 	 */
 	notEqualTo(arg){
-		switch(arguments.length){
-			case 1:
-				if(typeof arg === 'object' && arg instanceof Rational){
-					return !this.equalTo(arg);
-				}
-				else{
-					arg = this._validate(arg);
-					return !this.equalTo(arg);
-				}
-			default:
-				throw TypeError(`Rational: invalid number of arguments`);
-		}
+		return this._compare(...arguments) !== 0;
 	}
 
 	/**
 	 * @method
 	 * @instance
-	 * @memberof module:rational-module.Rational
-	 * @desc     Returns this Rational object converted to a real number.
-	 * @returns  {number} Real number.
+	 * @memberof module:rational-module.BigRational
+	 * @returns  {number} The nearest number to the quotient, whatever the size of its terms.
 	 * @throws   {TypeError} If an argument was given.
 	 */
 	valueOf(){
 		if(arguments.length > 0){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		return this.num / this.den;
+		if(this.num === 0n){
+			return 0;
+		}
+
+		const negative = this.num < 0n;
+		const n = negative ? -this.num : this.num;
+		const diff = n.toString(2).length - this.den.toString(2).length;
+
+		if(diff > 1025){
+			return negative ? -Infinity : Infinity;
+		}
+		if(diff < -1076){
+			return negative ? -0 : 0;
+		}
+
+		/* n/d = (q + rem/d')·2^-shift, with 2^61 <= q < 2^63, rounded once. */
+		const shift = 62 - diff;
+		const a = shift > 0 ? n << BigInt(shift) : n;
+		const b = shift < 0 ? this.den << BigInt(-shift) : this.den;
+
+		let q = a / b;
+		const rem = a % b;
+
+		const bits = q.toString(2).length;
+		const top = bits - 1 - shift;
+
+		if(top > 1023){
+			return negative ? -Infinity : Infinity;
+		}
+		if(top < -1075){
+			return negative ? -0 : 0;
+		}
+
+		const drop = BigInt(bits - (top < -1022 ? top + 1075 : 53));
+		const low = q & ((1n << drop) - 1n), half = 1n << (drop - 1n);
+		q >>= drop;
+
+		if(low > half || (low === half && (rem !== 0n || (q & 1n)))){
+			q++;
+		}
+
+		/* Scaled in two steps, the power of two alone possibly beyond the range of numbers. */
+		const e = Number(drop) - shift, e1 = Math.trunc(e / 2);
+		const x = Number(q) * 2 ** e1 * 2 ** (e - e1);
+
+		return negative ? -x : x;
 	}
 
+	/**
+	 * @method
+	 * @instance
+	 * @memberof module:rational-module.BigRational
+	 * @returns  {string} The "n/d" string representation.
+	 * @throws   {TypeError} If an argument was given.
+	 */
 	toString(){
 		if(arguments.length > 0){
 			throw TypeError(`Rational: invalid number of arguments`);
 		}
-		return `${this.num < 0 ? '-' : ''}${Math.abs(this.num)}/${this.den}`;
+		return `${this.num}/${this.den}`;
 	}
 }
 
 module.exports.Rational = Rational;
+module.exports.Accumulator = Accumulator;
+module.exports.BigRational = BigRational;
@@ -6,13 +6,20 @@
  * A testing module for the rational template class defined by rational.h
  */
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <list>
 #include <stdexcept>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "../include/rational.h"
+#include "../include/bigint.h"
+#include "../include/rational_vector.h"
+#include "../include/rational_accumulator.h"
+#include "../include/rational_parallel.h"
 
 /**
  * A namespace to enclose the unit testing code.
@@ -58,6 +65,11 @@ namespace utest{
 	void test6(); void test7(); void test8(); void test9(); void test10();
 	void test11(); void test12(); void test13(); void test14(); void test15();
 	void test16(); void test17(); void test18(); void test19(); void test20();
+	void test21(); void test22(); void test23(); void test24(); void test25();
+	void test26(); void test27(); void test28(); void test29(); void test30();
+	void test31(); void test32(); void test33(); void test34(); void test35();
+	void test36();
+	void test37();
 
 	/* Prepare test environment */
 	int testCount   = 1;
@@ -303,6 +315,191 @@ void utest::loadTestData(){
 	testPtr->method = test20;
 
 	suitePtr->testList->push_back(testPtr);
+
+	// TEST #30 - Integer power
+	testPtr = new Test();
+
+	testPtr->desc   = "Integer power";
+	testPtr->skip   = false;
+	testPtr->method = test30;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #31 - Character conversion
+	testPtr = new Test();
+
+	testPtr->desc   = "Character conversion";
+	testPtr->skip   = false;
+	testPtr->method = test31;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #33 - Floating point conversion
+	testPtr = new Test();
+
+	testPtr->desc   = "Floating point conversion";
+	testPtr->skip   = false;
+	testPtr->method = test33;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #34 - Best rational approximation
+	testPtr = new Test();
+
+	testPtr->desc   = "Best rational approximation";
+	testPtr->skip   = false;
+	testPtr->method = test34;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #35 - Correctly rounded conversion
+	testPtr = new Test();
+
+	testPtr->desc   = "Correctly rounded conversion";
+	testPtr->skip   = false;
+	testPtr->method = test35;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #36 - Rounding and decimal conversion
+	testPtr = new Test();
+
+	testPtr->desc   = "Rounding and decimal conversion";
+	testPtr->skip   = false;
+	testPtr->method = test36;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #37 - Repeating decimal expansion
+	testPtr = new Test();
+
+	testPtr->desc   = "Repeating decimal expansion";
+	testPtr->skip   = false;
+	testPtr->method = test37;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST SUITE #6 - Kernels
+	suitePtr = new Suite();
+
+	suitePtr->desc = "Test Suite #6 - Kernels";
+	suitePtr->testList = new std::list<TestPtr>();
+
+	suites.push_back(suitePtr);
+
+	// TEST #21 - Greatest common divisor
+	testPtr = new Test();
+
+	testPtr->desc   = "Greatest common divisor";
+	testPtr->skip   = false;
+	testPtr->method = test21;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #22 - Overflow checked arithmetic
+	testPtr = new Test();
+
+	testPtr->desc   = "Overflow checked arithmetic";
+	testPtr->skip   = false;
+	testPtr->method = test22;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #25 - Three-way comparison
+	testPtr = new Test();
+
+	testPtr->desc   = "Three-way comparison";
+	testPtr->skip   = false;
+	testPtr->method = test25;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST SUITE #7 - Arbitrary precision
+	suitePtr = new Suite();
+
+	suitePtr->desc = "Test Suite #7 - Arbitrary precision";
+	suitePtr->testList = new std::list<TestPtr>();
+
+	suites.push_back(suitePtr);
+
+	// TEST #23 - Arbitrary precision integer
+	testPtr = new Test();
+
+	testPtr->desc   = "Arbitrary precision integer";
+	testPtr->skip   = false;
+	testPtr->method = test23;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #24 - Arbitrary precision rational
+	testPtr = new Test();
+
+	testPtr->desc   = "Arbitrary precision rational";
+	testPtr->skip   = false;
+	testPtr->method = test24;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST SUITE #8 - Constant expressions
+	suitePtr = new Suite();
+
+	suitePtr->desc = "Test Suite #8 - Constant expressions";
+	suitePtr->testList = new std::list<TestPtr>();
+
+	suites.push_back(suitePtr);
+
+	// TEST #26 - Compile time evaluation
+	testPtr = new Test();
+
+	testPtr->desc   = "Compile time evaluation";
+	testPtr->skip   = false;
+	testPtr->method = test26;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST SUITE #9 - Batch operations
+	suitePtr = new Suite();
+
+	suitePtr->desc = "Test Suite #9 - Batch operations";
+	suitePtr->testList = new std::list<TestPtr>();
+
+	suites.push_back(suitePtr);
+
+	// TEST #27 - Structure of arrays container
+	testPtr = new Test();
+
+	testPtr->desc   = "Structure of arrays container";
+	testPtr->skip   = false;
+	testPtr->method = test27;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #28 - Deferred normalization accumulator
+	testPtr = new Test();
+
+	testPtr->desc   = "Deferred normalization accumulator";
+	testPtr->skip   = false;
+	testPtr->method = test28;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #29 - Parallel reduction
+	testPtr = new Test();
+
+	testPtr->desc   = "Parallel reduction";
+	testPtr->skip   = false;
+	testPtr->method = test29;
+
+	suitePtr->testList->push_back(testPtr);
+
+	// TEST #32 - Elementwise operations on external arrays
+	testPtr = new Test();
+
+	testPtr->desc   = "Elementwise operations on external arrays";
+	testPtr->skip   = false;
+	testPtr->method = test32;
+
+	suitePtr->testList->push_back(testPtr);
 }
 
 void utest::testRunner(){
@@ -669,3 +866,883 @@ void utest::test20(){
 
 	_assert(2 * big == maxint);
 }
+
+/** Test#21 - Greatest common divisor. */
+void utest::test21(){
+	_assert(binary_gcd(0, 0) == 0);
+	_assert(binary_gcd(0, 7) == 7);
+	_assert(binary_gcd(7, 0) == 7);
+	_assert(binary_gcd(12, 18) == 6);
+	_assert(binary_gcd(-12, 18) == 6);
+	_assert(binary_gcd(12, -18) == 6);
+	_assert(binary_gcd(-12, -18) == 6);
+	_assert(binary_gcd(1L << 40, 3L << 20) == 1L << 20);
+
+	long maxlong = (std::numeric_limits<long>::max)();
+	_assert(binary_gcd(maxlong, maxlong - 1) == 1);
+	_assert(binary_gcd((std::numeric_limits<long>::min)(), 6L) == 2);
+
+	/* Unsigned operands above the signed maximum. */
+	_assert(binary_gcd(3000000001u, 3u) == 1u);
+	_assert(binary_gcd(4000000000u, 3000000000u) == 1000000000u);
+	_assert(binary_gcd((std::numeric_limits<unsigned long>::max)(), 5UL) == 5UL);
+	_assert(binary_gcd((std::numeric_limits<unsigned long>::max)() - 1, (std::numeric_limits<unsigned long>::max)() - 3) == 2UL);
+
+	for(unsigned a = 4294967200u; a != 0; a++)
+		for(unsigned b = 0; b <= 50; b++)
+			_assert(binary_gcd(a, b) == euclid_gcd(a, b, 0u));
+
+	for(int a = -50; a <= 50; a++)
+		for(int b = -50; b <= 50; b++){
+			int e = euclid_gcd(a, b);
+			_assert(binary_gcd(a, b) == (e < 0 ? -e : e));
+		}
+
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+	/* Trailing zeros beyond the low 64 bits. */
+	const __int128 p = static_cast<__int128>(3) << 100;
+	_assert(binary_gcd(p, static_cast<__int128>(6) << 70) == static_cast<__int128>(6) << 70);
+#endif
+}
+
+/** Test#22 - Overflow checked arithmetic. */
+void utest::test22(){
+	const int maxint = (std::numeric_limits<int>::max)();
+	const long maxlong = (std::numeric_limits<long>::max)();
+	const long minlong = (std::numeric_limits<long>::min)();
+
+	/* Unreduced intermediates wider than the integer type do not overflow. */
+	_assert(rational<int>(maxint, 4) + rational<int>(maxint, 4) == rational<int>(maxint, 2));
+	_assert(rational<long>(maxlong, 4) + rational<long>(maxlong, 4) == rational<long>(maxlong, 2));
+	_assert(rational<long>(maxlong, 4) - rational<long>(-maxlong, 4) == rational<long>(maxlong, 2));
+
+	bool thrown = false;
+	rational<long> r(maxlong, 3);
+
+	try{ r += rational<long>(1, 2); }
+	catch(rational_overflow&){ thrown = true; }
+	_assert(thrown);
+	_assert(r == rational<long>(maxlong, 3));
+
+	thrown = false;
+	try{ r *= 3L; }
+	catch(rational_overflow&){ thrown = true; }
+	_assert(!thrown);
+	_assert(r == maxlong);
+
+	thrown = false;
+	try{ ++r; }
+	catch(rational_overflow&){ thrown = true; }
+	_assert(thrown);
+	_assert(r == maxlong);
+
+	thrown = false;
+	try{ r *= rational<long>(2, 3); }
+	catch(rational_overflow&){ thrown = true; }
+	_assert(thrown);
+
+	thrown = false;
+	try{ r /= rational<long>(1, 2); }
+	catch(rational_overflow&){ thrown = true; }
+	_assert(thrown);
+	_assert(r == maxlong);
+
+	thrown = false;
+	try{ r = -rational<long>(minlong); }
+	catch(rational_overflow&){ thrown = true; }
+	_assert(thrown);
+
+	thrown = false;
+	try{ rational<int>(maxint) + 1; }
+	catch(bad_rational&){ thrown = true; }
+	_assert(thrown);
+}
+
+/** Test#23 - Arbitrary precision integer. */
+void utest::test23(){
+	const long long values[] = {
+		0, 1, -1, 2, -2, 7, -7, 1000000007, -1000000007, 4294967295LL, 4294967296LL, -4294967296LL,
+		(std::numeric_limits<long long>::max)(), (std::numeric_limits<long long>::min)(),
+		(std::numeric_limits<long long>::max)() / 3, (std::numeric_limits<long long>::min)() / 5
+	};
+
+	/* Results that fit in a long long agree with the built-in arithmetic. */
+	for(long long a : values)
+		for(long long b : values){
+			long long r;
+
+			if(!__builtin_add_overflow(a, b, &r)) _assert(bigint(a) + bigint(b) == r);
+			if(!__builtin_sub_overflow(a, b, &r)) _assert(bigint(a) - bigint(b) == r);
+			if(!__builtin_mul_overflow(a, b, &r)) _assert(bigint(a) * bigint(b) == r);
+
+			if(b != 0 && !(b == -1 && a == (std::numeric_limits<long long>::min)())){
+				_assert(bigint(a) / bigint(b) == a / b);
+				_assert(bigint(a) % bigint(b) == a % b);
+			}
+
+			_assert((bigint(a) < bigint(b)) == (a < b));
+			_assert((bigint(a) == bigint(b)) == (a == b));
+		}
+
+	/* Results that do not fit in a long long. */
+	const bigint two64 = bigint((std::numeric_limits<unsigned long long>::max)()) + 1;
+	_assert(two64.to_string() == "18446744073709551616");
+	_assert((two64 * two64).to_string() == "340282366920938463463374607431768211456");
+	_assert((-two64 * two64 * two64).to_string() == "-6277101735386680763835789423207666416102355444464034512896");
+
+	const bigint p("170141183460469231731687303715884105727");  // 2^127 - 1
+	const bigint q("18446744073709551557");                     // largest 64-bit prime
+	const bigint r("-123456789012345678901234567890");
+
+	_assert(p / q * q + p % q == p);
+	_assert(r / q * q + r % q == r);
+	_assert((r % q).sign() < 0);
+	_assert(p * q / q == p);
+	_assert(p * r / r == p);
+	_assert((p * r) % p == 0);
+	_assert(p + r - p == r);
+	_assert(-(-r) == r);
+	_assert(r < q && q < p && -p < r);
+	_assert(static_cast<long long>(bigint(-42)) == -42);
+	_assert(static_cast<double>(two64) == 18446744073709551616.0);
+
+	/* The quotient of the most negative value by minus one. */
+	const bigint min((std::numeric_limits<long long>::min)());
+	_assert((min / -1).to_string() == "9223372036854775808");
+	_assert(min / -1 - 1 == (std::numeric_limits<long long>::max)());
+
+	std::ostringstream ss;
+	ss << r;
+	_assert(ss.str() == "-123456789012345678901234567890");
+
+	bigint t;
+	std::istringstream is(" -98765432109876543210 ");
+	is >> t;
+	_assert(t == bigint("-98765432109876543210"));
+
+	/* Little endian 64-bit words, as exchanged with JavaScript BigInt values. */
+	const std::uint64_t words[] = { 0x0123456789abcdefULL, 0, 0xfedcba9876543210ULL };
+	const bigint w = bigint::from_words(true, words, 3);
+
+	_assert(w == -(bigint(0xfedcba9876543210ULL) * two64 * two64 + bigint(0x0123456789abcdefULL)));
+	_assert(w.to_words() == std::vector<std::uint64_t>(words, words + 3));
+	_assert(w.bit_length() == 192);
+
+	const std::uint64_t high[] = { 0, 0x8000000000000000ULL, 0 };
+	_assert(bigint::from_words(false, high, 3) == two64 * bigint(0x8000000000000000ULL));
+	_assert(bigint::from_words(false, high, 3).to_words().size() == 2);
+	_assert(bigint::from_words(true, high, 1) == 0 && bigint().to_words().empty() && bigint().bit_length() == 0);
+	_assert(bigint::from_words(true, high + 1, 1) == min);
+	_assert(min.to_words() == std::vector<std::uint64_t>(1, 0x8000000000000000ULL) && min.bit_length() == 64);
+	_assert(bigint(-1).to_words() == std::vector<std::uint64_t>(1, 1) && bigint(-1).bit_length() == 1);
+	_assert(bigint(0xffffffffULL).bit_length() == 32 && bigint(0x100000000ULL).bit_length() == 33);
+}
+
+/** Test#24 - Arbitrary precision rational. */
+void utest::test24(){
+	const long maxlong = (std::numeric_limits<long>::max)();
+
+	const rational<bigint> a(bigint(maxlong), bigint(3));
+	const rational<bigint> b(bigint(maxlong), bigint(5));
+
+	/* Terms beyond 64 bits. */
+	rational<bigint> c = a * b;
+	_assert(c.numerator() == bigint(maxlong) * bigint(maxlong));
+	_assert(c.denominator() == 15);
+
+	c = a + b;
+	_assert(c.numerator() == bigint(maxlong) * 8);
+	_assert(c.denominator() == 15);
+
+	c = rational<bigint>(1, bigint(maxlong)) + rational<bigint>(1, bigint(maxlong) + 2);
+	_assert(c.denominator() == bigint(maxlong) * (bigint(maxlong) + 2));
+
+	c /= c;
+	_assert(c == bigint(1));
+
+	_assert(a < b * bigint(2) && b < a && -a < b);
+	_assert(rational<bigint>(bigint("-100000000000000000000"), bigint("-300000000000000000000")) == rational<bigint>(1, 3));
+
+	/* Conversions from and to rationals of built-in integers. */
+	_assert(rational<bigint>(rational<long>(3, 4)) == rational<bigint>(3, 4));
+	_assert(rational<long>(rational<bigint>(-3, 4)) == rational<long>(-3, 4));
+
+	std::ostringstream ss;
+	ss << a * a;
+	_assert(ss.str() == "85070591730234615847396907784232501249/9");
+	_assert(rational_cast<double>(rational<bigint>(1, 4)) == 0.25);
+}
+
+/** Test#25 - Three-way comparison. */
+void utest::test25(){
+	const long maxlong = (std::numeric_limits<long>::max)();
+
+	_assert(rational<long>(1, 3).compare(rational<long>(1, 2)) == -1);
+	_assert(rational<long>(1, 2).compare(rational<long>(1, 3)) == 1);
+	_assert(rational<long>(-1, 2).compare(rational<long>(-1, 2)) == 0);
+	_assert(rational<long>(maxlong - 1, maxlong).compare(rational<long>(maxlong - 2, maxlong - 1)) == 1);
+	_assert(rational<long>(-maxlong, 2).compare(rational<long>(-maxlong + 1, 2)) == -1);
+
+	_assert(rational<long>(7, 2).compare(3L) == 1);
+	_assert(rational<long>(-7, 2).compare(-3L) == -1);
+	_assert(rational<long>(6, 2).compare(3L) == 0);
+
+	_assert(rational<long>(7, 2) > 3L && !(rational<long>(6, 2) > 3L));
+	_assert(rational<long>(-7, 2) < -3L && !(rational<long>(-6, 2) < -3L));
+
+	/* The cross multiplication and continued fraction kernels agree. */
+	for(int a = -12; a <= 12; a++)
+		for(int b = 1; b <= 12; b++)
+			for(int c = -12; c <= 12; c++)
+				for(int d = 1; d <= 12; d++){
+					const rational<int> x(a, b), y(c, d);
+					const int e = (a * d > c * b) - (a * d < c * b);
+
+					_assert(cross_compare(x, y) == e);
+					_assert(cf_compare(x, y) == e);
+					_assert((x < y) == (e < 0) && (x > y) == (e > 0));
+				}
+
+	_assert(rational<bigint>(bigint(maxlong), 3).compare(rational<bigint>(bigint(maxlong) + 1, 3)) == -1);
+}
+
+/** Test#26 - Compile time evaluation. */
+void utest::test26(){
+	/* A constant table, normalized and reduced by the compiler. */
+	constexpr rational<long> rates[] = { rational<long>(14, 100), rational<long>(-6, -40), rational<long>(5, 25) };
+
+	static_assert(rates[0].numerator() == 7 && rates[0].denominator() == 50, "constexpr normalization");
+	static_assert(rates[1] == rational<long>(3, 20), "constexpr normalization");
+
+	constexpr rational<long> sum = rates[0] + rates[1] + rates[2];
+	static_assert(sum == rational<long>(49, 100), "constexpr addition");
+	static_assert(rates[0] * rates[2] - rates[1] / 3L == rational<long>(-11, 500), "constexpr arithmetic");
+	static_assert(-rates[0] < rates[1] && rates[2] > rates[1] && rates[0].compare(rates[0]) == 0, "constexpr comparison");
+	static_assert(abs(rational<int>(-1, 2)) == rational<int>(1, 2) && !rational<int>(), "constexpr helpers");
+	static_assert(rational_cast<double>(rates[2]) == 0.2, "constexpr conversion");
+	static_assert(rational<int>(rational<long>(3, 4)) == rational<int>(3, 4), "constexpr converting constructor");
+	static_assert(binary_gcd(84, 36) == 12 && euclid_gcd(84L, 36L) == 12L, "constexpr gcd kernels");
+
+	_assert(sum.numerator() == 49 && sum.denominator() == 100);
+
+	/* The same operations still throw at run time. */
+	try{
+		rational<int> r((std::numeric_limits<int>::max)());
+		r += 1;
+		_assert(false);
+	}
+	catch(const rational_overflow& e){}
+}
+
+/** Test#27 - Structure of arrays container. */
+void utest::test27(){
+	/* Elementwise operations agree with the scalar operators, across the vectorized body and the tail. */
+	rational_vector<int> a, b;
+	rational_vector<long> la, lb;
+
+	for(int i = -9; i <= 9; i++)
+		for(int j = 1; j <= 7; j++){
+			a.push_back(rational<int>(i, j));
+			b.push_back(rational<int>(j * 3 - 11, i * i + 1));
+			la.push_back(rational<long>(i, j));
+			lb.push_back(rational<long>(j * 3 - 11, i * i + 1));
+		}
+
+	_assert(a.size() == 133 && !a.empty());
+	_assert(a[9 * 7 + 1] == rational<int>(0) && a.denominators()[9 * 7 + 1] == 1);
+
+	const rational_vector<int> sum = a + b, diff = a - b, prod = a * b, quot = a / b;
+	const rational_vector<long> lsum = la + lb, lquot = la / lb;
+	const std::vector<int> cmp = a.compare(b);
+
+	for(std::size_t i = 0; i < a.size(); i++){
+		_assert(sum[i]  == a[i] + b[i]);
+		_assert(diff[i] == a[i] - b[i]);
+		_assert(prod[i] == a[i] * b[i]);
+		_assert(quot[i] == a[i] / b[i]);
+		_assert(cmp[i]  == a[i].compare(b[i]));
+
+		_assert(lsum[i]  == rational<long>(sum[i]));
+		_assert(lquot[i] == rational<long>(quot[i]));
+	}
+
+	/* Terms are stored normalized. */
+	rational_vector<short> s = { rational<short>(1, 6), rational<short>(-1, 3) };
+	s += rational_vector<short>{ rational<short>(1, 3), rational<short>(-1, 6) };
+	_assert(s.numerators()[0] == 1 && s.denominators()[0] == 2);
+	_assert(s.numerators()[1] == -1 && s.denominators()[1] == 2);
+
+	/* Errors leave the container unchanged. */
+	const int maxint = (std::numeric_limits<int>::max)();
+	rational_vector<int> c = { rational<int>(1, 2), rational<int>(maxint, 2) };
+	const rational_vector<int> d = { rational<int>(1, 3), rational<int>(maxint, 3) };
+	const rational_vector<int> z = { rational<int>(1, 3), rational<int>(0) };
+
+	try{ c += d; _assert(false); }
+	catch(const rational_overflow& e){}
+
+	try{ c /= z; _assert(false); }
+	catch(const rational_overflow& e){ _assert(false); }
+	catch(const bad_rational& e){}
+
+	try{ c *= rational_vector<int>(3); _assert(false); }
+	catch(const std::invalid_argument& e){}
+
+	_assert(c.size() == 2 && c[0] == rational<int>(1, 2) && c[1] == rational<int>(maxint, 2));
+
+	/* Integer types without a wider built-in type. */
+	rational_vector<bigint> e(2);
+	e.set(1, rational<bigint>(1, 3));
+	e += rational_vector<bigint>{ rational<bigint>(1, 2), rational<bigint>(1, 6) };
+	_assert(e[0] == rational<bigint>(1, 2) && e[1] == rational<bigint>(1, 2));
+	_assert(e.compare(e) == std::vector<int>(2, 0));
+}
+
+/** Test#28 - Deferred normalization accumulator. */
+void utest::test28(){
+	/* Sums and products agree with the normalizing operators. */
+	rational_accumulator<int> a;
+	rational_accumulator<long> b;
+	rational_accumulator<bigint> c;
+	rational<int> r;
+
+	for(int i = 1; i <= 200; i++){
+		const rational<int> x(i % 7 - 3, i % 11 + 1);
+
+		a += x;
+		b -= rational<long>(x);
+		c += rational<bigint>(rational<long>(x));
+		r += x;
+	}
+
+	_assert(a.value() == r);
+	_assert(b.value() == -rational<long>(r));
+	_assert(c.value() == rational<bigint>(rational<long>(r)));
+
+	rational_accumulator<long> p(rational<long>(1));
+	for(long i = 1; i <= 20; i++){
+		p *= rational<long>(i + 1, i);
+		p /= rational<long>(-1);
+	}
+	_assert(p.value() == rational<long>(21));
+
+	/* Products of long terms reduced in 128 bits. */
+	p.reset(rational<long>(1L << 62, 3));
+	p *= rational<long>(1L << 62, 5);
+	p /= rational<long>(1L << 62);
+	_assert(p.value() == rational<long>(1L << 62, 15));
+
+	/* Terms beyond the range of the integer type are reduced rather than overflowing. */
+	const long maxlong = (std::numeric_limits<long>::max)();
+	rational_accumulator<long> q;
+
+	for(int i = 0; i < 1000; i++)
+		q += rational<long>(maxlong / 1000, 3);
+	q -= rational<long>(maxlong / 1000 * 1000 - 3, 3);
+	_assert(q.value() == rational<long>(1));
+
+	rational_accumulator<int> h;
+	for(int i = 1; i <= 30; i++)
+		h += rational<int>(1, i);
+	try{
+		h.value();
+		_assert(false);
+	}
+	catch(const rational_overflow& e){}
+
+	h.reset(rational<int>(1, 2));
+	try{
+		h /= rational<int>(0);
+		_assert(false);
+	}
+	catch(const rational_overflow& e){ _assert(false); }
+	catch(const bad_rational& e){}
+	_assert(h.value() == rational<int>(1, 2));
+}
+
+/** Test#29 - Parallel reduction. */
+void utest::test29(){
+	std::vector< rational<long> > v;
+	rational<long> sum, product(1), min(1000), max(-1000);
+
+	for(long i = 1; i <= 50000; i++){
+		const rational<long> x(i % 13 - 6, i % 17 + 1);
+
+		v.push_back(x);
+		sum += x;
+		if(x < min) min = x;
+		if(x > max) max = x;
+	}
+	for(long i = 1; i <= 20; i++)
+		product *= v[i];
+
+	/* Results do not depend on the number of threads. */
+	for(std::size_t threads : { 0, 1, 3, 8 }){
+		thread_pool pool(threads);
+		_assert(pool.size() == threads);
+
+		_assert(parallel_reduce(pool, v.data(), v.size(), reduction::sum) == sum);
+		_assert(parallel_reduce(pool, v.data() + 1, 20, reduction::product) == product);
+		_assert(parallel_reduce(pool, v.data(), v.size(), reduction::min) == min);
+		_assert(parallel_reduce(pool, v.data(), v.size(), reduction::max) == max);
+
+		/* Neither does overflow. */
+		std::vector< rational<long> > w(3 * reduce_chunk, rational<long>((std::numeric_limits<long>::max)() / 8192));
+		try{
+			parallel_reduce(pool, w.data(), w.size(), reduction::sum);
+			_assert(false);
+		}
+		catch(const rational_overflow& e){}
+
+		_assert(parallel_reduce(pool, w.data(), 0, reduction::sum) == 0L);
+		_assert(parallel_reduce(pool, w.data(), 0, reduction::product) == 1L);
+		try{
+			parallel_reduce(pool, w.data(), 0, reduction::min);
+			_assert(false);
+		}
+		catch(const std::invalid_argument& e){}
+	}
+}
+
+/** Test#30 - Integer power. */
+void utest::test30(){
+	const long maxlong = (std::numeric_limits<long>::max)();
+
+	_assert(pow(rational<int>(2, 3), 0) == 1);
+	_assert(pow(rational<int>(0), 0) == 1);
+	_assert(pow(rational<int>(2, 3), 5) == rational<int>(32, 243));
+	_assert(pow(rational<int>(-2, 3), 3) == rational<int>(-8, 27));
+	_assert(pow(rational<int>(-2, 3), -3) == rational<int>(-27, 8));
+	_assert(pow(rational<int>(-2, 3), -4) == rational<int>(81, 16));
+	_assert(pow(rational<long>(3), 39) == rational<long>(4052555153018976267L));
+
+	/* Bases of magnitude one and zero take logarithmic time at any exponent. */
+	_assert(pow(rational<long>(-1), 1000000001LL) == -1L);
+	_assert(pow(rational<long>(1), (std::numeric_limits<long long>::min)()) == 1L);
+	_assert(pow(rational<long>(0), 1000000000LL) == 0L);
+
+	/* The last factor is not squared, so results at the limit do not overflow. */
+	_assert(pow(rational<long>(2), 62) == rational<long>(1L << 62));
+	_assert(pow(rational<long>(-2), 63) == (std::numeric_limits<long>::min)());
+	_assert(pow(rational<long>(-2), -62) == rational<long>(1, 1L << 62));
+	_assert(pow(rational<long>(maxlong), 1) == maxlong);
+
+	bool thrown = false;
+	try{ pow(rational<long>(3, 2), 40); }
+	catch(rational_overflow&){ thrown = true; }
+	_assert(thrown);
+
+	thrown = false;
+	try{ pow(rational<long>(2), 1000000000LL); }
+	catch(rational_overflow&){ thrown = true; }
+	_assert(thrown);
+
+	thrown = false;
+	try{ pow(rational<long>(0), -1); }
+	catch(rational_overflow&){}
+	catch(bad_rational&){ thrown = true; }
+	_assert(thrown);
+
+	/* Arbitrary precision powers do not overflow. */
+	rational<bigint> b = pow(rational<bigint>(bigint(3), bigint(2)), 100);
+	_assert(b.denominator() == pow(rational<bigint>(bigint(2)), 100).numerator());
+
+	static_assert(pow(rational<int>(2, 3), -2) == rational<int>(9, 4), "constexpr pow");
+}
+
+/** Test#31 - Character conversion. */
+void utest::test31(){
+	const long minlong = (std::numeric_limits<long>::min)();
+
+	char buf[48];
+	rational<long> r;
+
+	std::to_chars_result tr = to_chars(buf, buf + sizeof(buf), rational<long>(-6, 4));
+	_assert(tr.ec == std::errc() && std::string(buf, tr.ptr) == "-3/2");
+
+	tr = to_chars(buf, buf + sizeof(buf), rational<long>(minlong, (std::numeric_limits<long>::max)()));
+	_assert(tr.ec == std::errc() && std::string(buf, tr.ptr) == "-9223372036854775808/9223372036854775807");
+
+	tr = to_chars(buf, buf + 4, rational<long>(-3, 20));
+	_assert(tr.ec == std::errc::value_too_large);
+	tr = to_chars(buf, buf + 2, rational<long>(-3, 2));
+	_assert(tr.ec == std::errc::value_too_large);
+
+	/* Parsing normalizes, and stops at the first character not in the pattern. */
+	const std::string in[] = { "-6/-4", "42", "3/x", "0/-5", "7/2,1/3" };
+	const rational<long> out[] = { rational<long>(3, 2), 42L, 3L, 0L, rational<long>(7, 2) };
+	const std::size_t used[] = { 5, 2, 1, 4, 3 };
+
+	for(std::size_t i = 0; i < 5; i++){
+		std::from_chars_result fr = from_chars(in[i].data(), in[i].data() + in[i].size(), r);
+		_assert(fr.ec == std::errc() && r == out[i] && std::size_t(fr.ptr - in[i].data()) == used[i]);
+	}
+
+	r = rational<long>(1, 7);
+	for(const std::string& bad : { std::string("x"), std::string("+1/2"), std::string("/2") }){
+		std::from_chars_result fr = from_chars(bad.data(), bad.data() + bad.size(), r);
+		_assert(fr.ec == std::errc::invalid_argument && fr.ptr == bad.data());
+	}
+
+	const std::string zero("-1/0 ");
+	std::from_chars_result fz = from_chars(zero.data(), zero.data() + zero.size(), r);
+	_assert(fz.ec == std::errc::invalid_argument && fz.ptr == zero.data() + 4);
+	for(const std::string& big : { std::string("99999999999999999999/2"), std::string("1/99999999999999999999"), std::string("1/-9223372036854775808") }){
+		std::from_chars_result fr = from_chars(big.data(), big.data() + big.size(), r);
+		_assert(fr.ec == std::errc::result_out_of_range);
+	}
+	_assert(r == rational<long>(1, 7));
+
+	/* Round trips of the extremes. */
+	for(const rational<int>& q : { rational<int>((std::numeric_limits<int>::min)()), rational<int>(-1, (std::numeric_limits<int>::max)()) }){
+		rational<int> p;
+		tr = to_chars(buf, buf + sizeof(buf), q);
+		_assert(from_chars(buf, tr.ptr, p).ec == std::errc() && p == q);
+	}
+
+	/* Stream operators, formatted in place or through a formatting stream. */
+	std::ostringstream os;
+	os << rational<long>(-3, 4) << ' ' << std::setw(8) << rational<long>(5, 6) << ' '
+	   << std::left << std::setw(6) << std::setfill('*') << rational<int>(1, 2) << ' '
+	   << std::internal << std::setw(7) << std::setfill('0') << rational<int>(-1, 2) << ' '
+	   << std::setfill(' ') << std::showpos << rational<int>(1, 2) << ' ' << std::noshowpos
+	   << std::hex << rational<int>(255, 16);
+	_assert(os.str() == "-3/4      5/6 1/2*** -0001/2 +1/2 ff/10");
+
+	std::istringstream is("  3/-6 +7/+2 5/0 4");
+	rational<long> a, b;
+	is >> a >> b;
+	_assert(is && a == rational<long>(-1, 2) && b == rational<long>(7, 2));
+	is >> a;
+	_assert(is.fail() && !is.eof() && a == rational<long>(-1, 2));
+
+	is.clear();
+	is.exceptions(std::ios::failbit);
+	is.str("5/0");
+	bool thrown = false;
+	try{ is >> a; }
+	catch(bad_rational&){ thrown = true; }
+	_assert(thrown);
+
+	is.exceptions(std::ios::goodbit);
+	is.clear();
+	is.str("4");
+	is >> a;
+	_assert(is.fail() && is.eof() && a == rational<long>(-1, 2));
+
+	is.clear();
+	is.str("9/12");
+	is >> a;
+	_assert(!is.fail() && is.eof() && a == rational<long>(3, 4));
+
+	is.clear();
+	is.str("1a/10");
+	is >> std::hex >> a;
+	_assert(a == rational<long>(26, 16));
+}
+
+/** Test#32 - Elementwise operations on external arrays. */
+void utest::test32(){
+	/* The static functions agree with the container operators, across the blocks and the tail. */
+	rational_vector<int> a, b;
+	std::vector<long> an, ad, bn, bd;
+
+	for(int i = 0; i < 600; i++){
+		const rational<int> x(i % 37 - 18, i % 11 + 1), y(i % 13 - 6, i % 29 + 1);
+
+		a.push_back(x);
+		b.push_back(y);
+
+		an.push_back(x.numerator()); ad.push_back(x.denominator());
+		bn.push_back(y.numerator()); bd.push_back(y.denominator());
+	}
+
+	const rational_vector<int> sum = a + b, prod = a * b;
+	const std::vector<int> cmp = a.compare(b);
+
+	std::vector<int> rn(a.size()), rd(a.size()), c(a.size());
+	rational_vector<int>::add(a.numerators(), a.denominators(), b.numerators(), b.denominators(), rn.data(), rd.data(), a.size());
+
+	for(std::size_t i = 0; i < a.size(); i++)
+		_assert(rational<int>(rn[i], rd[i]) == sum[i] && rn[i] == sum.numerators()[i] && rd[i] == sum.denominators()[i]);
+
+	rational_vector<int>::compare(a.numerators(), a.denominators(), b.numerators(), b.denominators(), c.data(), a.size());
+	_assert(c == cmp);
+
+	/* Results stored over the operands, by the scalar operators for a type not widened through long long. */
+	rational_vector<long>::mul(an.data(), ad.data(), bn.data(), bd.data(), an.data(), ad.data(), an.size());
+	rational_vector<long>::sub(an.data(), ad.data(), bn.data(), bd.data(), bn.data(), bd.data(), an.size());
+
+	for(std::size_t i = 0; i < an.size(); i++){
+		_assert(rational<long>(an[i], ad[i]) == rational<long>(prod[i]) && ad[i] == prod.denominators()[i]);
+		_assert(rational<long>(bn[i], bd[i]) == rational<long>(prod[i]) - rational<long>(b[i]));
+	}
+
+	/* A zero divisor stores no result. */
+	const int n1[] = { 1, 2 }, d1[] = { 3, 5 }, zn[] = { 1, 0 }, zd[] = { 1, 1 };
+	int qn[] = { 7, 7 }, qd[] = { 7, 7 };
+
+	try{ rational_vector<int>::div(n1, d1, zn, zd, qn, qd, 2); _assert(false); }
+	catch(const rational_overflow& e){ _assert(false); }
+	catch(const bad_rational& e){}
+
+	_assert(qn[0] == 7 && qd[0] == 7);
+
+	rational_vector<int>::div(n1, d1, n1, d1, qn, qd, 2);
+	_assert(qn[0] == 1 && qd[0] == 1 && qn[1] == 1 && qd[1] == 1);
+}
+
+/** Test#33 - Floating point conversion. */
+void utest::test33(){
+	_assert(from_double<long>(0.75) == rational<long>(3, 4));
+	_assert(from_double<long>(-2.5) == rational<long>(-5, 2));
+	_assert(from_double<long>(-0.0) == rational<long>());
+	_assert(from_double<long>(1e18) == rational<long>(1000000000000000000L));
+	_assert(from_double<int>(-2147483648.0) == rational<int>((std::numeric_limits<int>::min)()));
+
+	/* The exact binary value, not the nearest decimal. */
+	rational<long> r = from_double<long>(0.1);
+	_assert(r == rational<long>(3602879701896397L, 36028797018963968L));
+	_assert(rational_cast<double>(r) == 0.1);
+
+	_assert(from_double<long>(std::ldexp(1.0, -62)) == rational<long>(1, 4611686018427387904L));
+	_assert(from_double<long>(-std::ldexp(1.0, 63)) == rational<long>((std::numeric_limits<long>::min)()));
+
+	/* Values outside of the range of the type, or needing a larger denominator. */
+	for(double x : { std::ldexp(1.0, 63), std::ldexp(1.0, -63), 1e-300, 2147483648.0 * 4294967296.0 * 4294967296.0, std::numeric_limits<double>::infinity() }){
+		try{ from_double<long>(x); _assert(false); }
+		catch(const rational_overflow& e){}
+	}
+
+	try{ from_double<int>(2147483648.0); _assert(false); }
+	catch(const rational_overflow& e){}
+
+	try{ from_double<long>(std::numeric_limits<double>::quiet_NaN()); _assert(false); }
+	catch(const std::invalid_argument& e){}
+}
+
+/** Test#34 - Best rational approximation. */
+void utest::test34(){
+	const rational<long> pi = from_double<long>(3.141592653589793);
+
+	_assert(limit_denominator(pi, 1000L) == rational<long>(355, 113));
+	_assert(limit_denominator(pi, 100L) == rational<long>(311, 99));
+	_assert(limit_denominator(pi, 1L) == rational<long>(3));
+	_assert(limit_denominator(-pi, 1000L) == rational<long>(-355, 113));
+	_assert(limit_denominator(from_double<long>(0.1), 1000000L) == rational<long>(1, 10));
+	_assert(limit_denominator(rational<long>(3, 8), 2L) == rational<long>(1, 2));
+	_assert(limit_denominator(rational<long>(1, 2), 1L) == rational<long>(0));
+	_assert(limit_denominator(rational<long>(-1, 2), 1L) == rational<long>(-1));
+	_assert(limit_denominator(rational<long>(7, 3), 3L) == rational<long>(7, 3));
+
+	/* The closest of all rationals with a denominator up to the bound, by exhaustive search. */
+	for(int d = 1; d <= 40; d++)
+	for(int n = -80; n <= 80; n++)
+	for(int bound = 1; bound <= 12; bound++){
+		const rational<int> x(n, d), y = limit_denominator(x, bound);
+		_assert(y.denominator() <= bound);
+
+		const rational<int> dist = abs(y - x);
+		for(int q = 1; q <= bound; q++){
+			const int p = (n * q) / d;
+			for(int k = p - 1; k <= p + 1; k++)
+				_assert(!(abs(rational<int>(k, q) - x) < dist));
+		}
+	}
+
+	/* Extreme terms, and a user defined integer type. */
+	const long maxlong = (std::numeric_limits<long>::max)();
+	_assert(limit_denominator(rational<long>(maxlong - 1, maxlong), 1000L) == rational<long>(1));
+	_assert(limit_denominator(rational<long>((std::numeric_limits<long>::min)() + 1, maxlong), maxlong - 1) == rational<long>(-1));
+
+	const rational<bigint> b = limit_denominator(rational<bigint>(bigint(314159265358979), bigint(100000000000000)), bigint(40000));
+	_assert(b == rational<bigint>(bigint(104348), bigint(33215)));
+
+	try{ limit_denominator(pi, 0L); _assert(false); }
+	catch(const std::invalid_argument& e){}
+}
+
+/** Test#35 - Correctly rounded conversion. */
+void utest::test35(){
+	const long maxlong = (std::numeric_limits<long>::max)(), minlong = (std::numeric_limits<long>::min)();
+
+	/* Terms beyond 53 bits, where dividing their rounded values rounds twice. */
+	_assert(rational_cast<double>(rational<long>(6957976319337655507L, 4377879084656308313L)) == 0x1.96df8e01f4763p+0);
+	_assert(rational_cast<double>(rational<long>(7678669178672730304L, 4153793910940307729L)) == 0x1.d93d4f2e6b5ebp+0);
+	_assert(rational_cast<double>(rational<long>(7776605050785008L, 10854936421132297L)) == 0x1.6ecd889add6d6p-1);
+
+	/* Ties to even, and the extremes. */
+	_assert(to_double(rational<long>(9007199254740993L)) == 9007199254740992.0);
+	_assert(to_double(rational<long>(9007199254740995L)) == 9007199254740996.0);
+	_assert(to_double(rational<long>(maxlong)) == 0x1p63);
+	_assert(to_double(rational<long>(minlong, 3)) == -0x1.5555555555555p+61);
+	_assert(to_double(rational<long>(1, maxlong)) == 0x1p-63);
+	_assert(to_double(rational<long>()) == 0.0);
+
+	/* Both paths agree on terms held exactly by a double. */
+	for(long n = -1000; n <= 1000; n += 7)
+	for(long d = 1; d <= 1000; d += 13){
+		const rational<long> r(n, d);
+		_assert(to_double(r) == double(r.numerator()) / double(r.denominator()));
+		_assert(rational_cast<double>(rational<int>(int(n), int(d))) == to_double(r));
+	}
+
+	for(double x : { 0.1, -2.5, 1.0 / 3.0, 0x1.fffffffffffffp-1, 1e18 })
+		_assert(rational_cast<double>(from_double<long>(x)) == x);
+
+	static_assert(rational_cast<double>(rational<long>(1, 3)) == 1.0 / 3.0, "constexpr conversion");
+}
+
+/** Test#36 - Rounding and decimal conversion. */
+void utest::test36(){
+	const rounding modes[] = {
+		rounding::floor, rounding::ceil, rounding::trunc, rounding::expand,
+		rounding::half_floor, rounding::half_ceil, rounding::half_trunc, rounding::half_expand, rounding::half_even
+	};
+
+	/* -2.5, -1.5, -0.6, -0.5, -0.4, 0.4, 0.5, 0.6, 1.5 and 2.5 in each mode. */
+	const rational<int> x[] = {
+		rational<int>(-5, 2), rational<int>(-3, 2), rational<int>(-3, 5), rational<int>(-1, 2), rational<int>(-2, 5),
+		rational<int>(2, 5), rational<int>(1, 2), rational<int>(3, 5), rational<int>(3, 2), rational<int>(5, 2)
+	};
+	const int y[9][10] = {
+		{ -3, -2, -1, -1, -1,  0,  0,  0,  1,  2 },
+		{ -2, -1,  0,  0,  0,  1,  1,  1,  2,  3 },
+		{ -2, -1,  0,  0,  0,  0,  0,  0,  1,  2 },
+		{ -3, -2, -1, -1, -1,  1,  1,  1,  2,  3 },
+		{ -3, -2, -1, -1,  0,  0,  0,  1,  1,  2 },
+		{ -2, -1, -1,  0,  0,  0,  1,  1,  2,  3 },
+		{ -2, -1, -1,  0,  0,  0,  0,  1,  1,  2 },
+		{ -3, -2, -1, -1,  0,  0,  1,  1,  2,  3 },
+		{ -2, -2, -1,  0,  0,  0,  0,  1,  2,  2 }
+	};
+
+	for(int m = 0; m < 9; m++)
+		for(int i = 0; i < 10; i++)
+			_assert(round(x[i], modes[m]) == y[m][i]);
+
+	_assert(floor(rational<int>(-7, 3)) == -3 && ceil(rational<int>(-7, 3)) == -2 && trunc(rational<int>(-7, 3)) == -2);
+	_assert(round(rational<int>(7)) == 7 && round(rational<int>(7, 2)) == 4);
+	_assert(floor(rational<long>((std::numeric_limits<long>::min)())) == (std::numeric_limits<long>::min)());
+	_assert(ceil(rational<long>((std::numeric_limits<long>::max)(), 2)) == (std::numeric_limits<long>::max)() / 2 + 1);
+	_assert(floor(rational<bigint>(bigint(-7), bigint(3))) == bigint(-3) && round(rational<bigint>(bigint(5), bigint(2))) == bigint(2));
+
+	static_assert(round(rational<int>(-5, 2), rounding::half_expand) == -3, "constexpr rounding");
+
+	char buf[64];
+
+	const auto decimal = [&buf](const rational<long>& r, int digits, rounding mode = rounding::half_even){
+		const std::to_chars_result res = to_decimal(buf, buf + sizeof(buf), r, digits, mode);
+		_assert(res.ec == std::errc());
+		return std::string(buf, res.ptr);
+	};
+
+	_assert(decimal(rational<long>(1, 3), 2) == "0.33");
+	_assert(decimal(rational<long>(-2, 3), 2) == "-0.67");
+	_assert(decimal(rational<long>(1, 8), 2) == "0.12");
+	_assert(decimal(rational<long>(1, 8), 2, rounding::half_expand) == "0.13");
+	_assert(decimal(rational<long>(1999, 2000), 2) == "1.00");
+	_assert(decimal(rational<long>(-1999, 200), 2) == "-10.00");
+	_assert(decimal(rational<long>(-1, 1000), 2) == "0.00");
+	_assert(decimal(rational<long>(-1, 1000), 2, rounding::floor) == "-0.01");
+	_assert(decimal(rational<long>(7, 2), 0) == "4");
+	_assert(decimal(rational<long>(1, 7), 20) == "0.14285714285714285714");
+	_assert(decimal(rational<long>((std::numeric_limits<long>::min)()), 3) == "-9223372036854775808.000");
+	_assert(decimal(rational<long>((std::numeric_limits<long>::max)() - 1, (std::numeric_limits<long>::max)()), 20) == "0.99999999999999999989");
+
+	/* The decimal digits are those of the integer rounded from r·10^digits. */
+	for(long n = -150; n <= 150; n += 7)
+	for(long d = 1; d <= 40; d++)
+	for(int digits = 0; digits <= 3; digits++)
+	for(rounding mode : modes){
+		long scale = 1;
+		for(int i = 0; i < digits; i++) scale *= 10;
+
+		const long s = round(rational<long>(n * scale, d), mode);
+
+		std::string expected = std::to_string(s < 0 ? -s : s);
+		if(expected.size() <= std::size_t(digits)) expected.insert(0, digits + 1 - expected.size(), '0');
+		if(digits) expected.insert(expected.size() - digits, ".");
+		if(s < 0) expected.insert(0, "-");
+
+		_assert(decimal(rational<long>(n, d), digits, mode) == expected);
+	}
+
+	/* A buffer too small, and a negative number of digits. */
+	_assert(to_decimal(buf, buf + 4, rational<long>(1, 3), 3).ec == std::errc::value_too_large);
+	_assert(to_decimal(buf, buf + 3, rational<long>(1999, 200), 1).ec == std::errc::value_too_large);
+	_assert(to_decimal(buf, buf + 5, rational<long>(1, 3), 3).ec == std::errc());
+
+	try{ to_decimal(buf, buf + sizeof(buf), rational<long>(1, 3), -1); _assert(false); }
+	catch(const std::invalid_argument& e){}
+}
+
+/** Test#37 - Repeating decimal expansion. */
+void utest::test37(){
+	char buf[128];
+
+	const auto expansion = [&buf](const rational<long>& r, int max_digits, bool repeat = true){
+		const std::to_chars_result res = to_decimal_expansion(buf, buf + sizeof(buf), r, max_digits, repeat);
+		_assert(res.ec == std::errc());
+		return std::string(buf, res.ptr);
+	};
+
+	_assert(expansion(rational<long>(1, 7), 20) == "0.(142857)");
+	_assert(expansion(rational<long>(-7, 6), 20) == "-1.1(6)");
+	_assert(expansion(rational<long>(1, 3), 20) == "0.(3)");
+	_assert(expansion(rational<long>(3, 8), 20) == "0.375");
+	_assert(expansion(rational<long>(-5), 20) == "-5");
+	_assert(expansion(rational<long>(0), 20) == "0");
+	_assert(expansion(rational<long>(1, 12), 20) == "0.08(3)");
+	_assert(expansion(rational<long>(1, 7), 6) == "0.(142857)");
+	_assert(expansion(rational<long>(1, 7), 5) == "0.14285...");
+	_assert(expansion(rational<long>(1, 7), 0) == "0...");
+	_assert(expansion(rational<long>(1, 1024), 5) == "0.00097...");
+	_assert(expansion(rational<long>(1, 7), 8, false) == "0.14285714...");
+	_assert(expansion(rational<long>(3, 8), 3, false) == "0.375");
+	_assert(expansion(rational<long>(1, 97), 100) ==
+		"0.(010309278350515463917525773195876288659793814432989690721649484536082474226804123711340206185567)");
+	_assert(expansion(rational<long>((std::numeric_limits<long>::min)(), (std::numeric_limits<long>::max)()), 25) ==
+		"-1.0000000000000000001084202...");
+
+	/* Against the remainders found by a search of all the previous ones. */
+	for(long n = -60; n <= 60; n += 7)
+	for(long d = 1; d <= 120; d++){
+		const rational<long> r(n, d);
+
+		const long a = r.numerator() < 0 ? -r.numerator() : r.numerator(), b = r.denominator();
+
+		std::string expected = (r.numerator() < 0 ? "-" : "") + std::to_string(a / b);
+		std::vector<long> seen;
+
+		long rem = a % b;
+		if(rem) expected += '.';
+
+		for(std::string digits; rem; ){
+			const std::vector<long>::iterator it = std::find(seen.begin(), seen.end(), rem);
+
+			if(it != seen.end()){
+				digits.insert(it - seen.begin(), "(");
+				expected += digits + ')';
+				break;
+			}
+
+			seen.push_back(rem);
+			digits += char('0' + rem * 10 / b);
+			rem = rem * 10 % b;
+
+			if(!rem) expected += digits;
+		}
+
+		_assert(expansion(r, 120) == expected);
+	}
+
+	/* A buffer too small, and a negative number of digits. */
+	_assert(to_decimal_expansion(buf, buf + 9, rational<long>(1, 7), 10).ec == std::errc::value_too_large);
+	_assert(to_decimal_expansion(buf, buf + 10, rational<long>(1, 7), 10).ec == std::errc());
+	_assert(to_decimal_expansion(buf, buf + 6, rational<long>(1, 7), 3).ec == std::errc::value_too_large);
+	_assert(to_decimal_expansion(buf, buf + 8, rational<long>(1, 7), 3).ec == std::errc());
+
+	try{ to_decimal_expansion(buf, buf + sizeof(buf), rational<long>(1, 3), -1); _assert(false); }
+	catch(const std::invalid_argument& e){}
+}
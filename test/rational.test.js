@@ -18,6 +18,16 @@ const rational_addon = require('../build/Release/rational');
  */
 const rational_module = require('./rational.module');
 
+/**
+ * @const Worker {function} The worker_threads Worker class, loading the addon in several environments.
+ */
+const { Worker } = require('node:worker_threads');
+
+/**
+ * @const v8 {object} The v8 module, enabling the natives syntax that forces optimization.
+ */
+const v8 = require('node:v8');
+
 /* Prepare test environment */
 let testCount   = 1;
 let passCount   = 0;
@@ -129,32 +139,73 @@ function loadTestData(){
 	testData.skip = false;
 	suites.get(suiteDesc).push(testData);
 
+	// TEST ### - One argument constructor ... valid test#4
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			assert.strictEqual(new lib.Rational('-6/4').toString(), '-3/2');
+			assert.strictEqual(new lib.Rational('6/-4').toString(), '-3/2');
+			assert.strictEqual(new lib.Rational('0/7').toString(), '0/1');
+
+			let r = new lib.Rational(-22, 7);
+			assert.strictEqual(new lib.Rational(r.toString()).toString(), r.toString());
+			assert(new lib.Rational(r.toString()).equalTo(r));
+		}
+
+		let r = new rational_addon.Rational(-(2 ** 53), 2 ** 53 - 1);
+		assert.strictEqual(r.toString(), `-${2 ** 53}/${2 ** 53 - 1}`);
+		assert(new rational_addon.Rational(r.toString()).equalTo(r));
+	};
+	testData.desc = 'One argument constructor ... valid test#4';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - One argument constructor ... valid test#5
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			assert.strictEqual(new lib.Rational(2n).toString(), '2/1');
+			assert.strictEqual(new lib.Rational(-7n).toString(), '-7/1');
+			assert(new lib.Rational(1, 2).add(1n).equalTo(new lib.Rational(3, 2)));
+			assert(new lib.Rational(1, 2).lessThan(1n));
+		}
+
+		let r = new rational_addon.Rational(2n ** 63n - 1n);
+		assert.strictEqual(r.toString(), `${2n ** 63n - 1n}/1`);
+		assert.strictEqual(new rational_addon.Rational(-(2n ** 63n)).toString(), `${-(2n ** 63n)}/1`);
+	};
+	testData.desc = 'One argument constructor ... valid test#5';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
 	// TEST ### - One argument constructor ... invalid test#1
 	testData = {};
 	testData.method = () => {
 
 		assert.throws(
 			() => {
-				new rational_addon.Rational(2n);
+				new rational_addon.Rational(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, 'rational_addon.Rational(2n)');
+				assert(err instanceof RangeError, 'rational_addon.Rational(2n ** 63n)');
 				assert.strictEqual(
-					err.message, 'Rational: BigInt type is not accepted',
-					'rational_addon.Rational(2n)'
+					err.message, 'Rational: arithmetic overflow',
+					'rational_addon.Rational(2n ** 63n)'
 				);
 				return true;
 			}
 		);
 		assert.throws(
 			() => {
-				new rational_module.Rational(2n);
+				new rational_module.Rational(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, 'rational_module.Rational(2n)');
+				assert(err instanceof RangeError, 'rational_module.Rational(2n ** 63n)');
 				assert.strictEqual(
-					err.message, 'Rational: BigInt type is not accepted',
-					'rational_module.Rational(2n)'
+					err.message, 'Rational: arithmetic overflow',
+					'rational_module.Rational(2n ** 63n)'
 				);
 				return true;
 			}
@@ -345,6 +396,129 @@ function loadTestData(){
 	testData.skip = false;
 	suites.get(suiteDesc).push(testData);
 
+	// TEST ### - One argument constructor ... invalid test#7
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			assert.throws(
+				() => {
+					new lib.Rational('3/0');
+				},
+				(err) => {
+					assert(err instanceof TypeError, `Rational('3/0')`);
+					assert.strictEqual(err.message, `Rational: bad rational, zero denominator`, `Rational('3/0')`);
+					return true;
+				}
+			);
+		}
+	};
+	testData.desc = 'One argument constructor ... invalid test#7';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - One argument constructor ... invalid test#8
+	testData = {};
+	testData.method = () => {
+		const Rational = rational_addon.Rational;
+
+		/* Called without 'new', the constructor throws the same exceptions. */
+		assert.strictEqual(Rational(0.5).toString(), '1/2');
+
+		for(const [arg, type, msg] of [[1e300, RangeError, 'arithmetic overflow'], [2n ** 70n, RangeError, 'arithmetic overflow'], ['x', TypeError, 'invalid argument'], ['3/0', TypeError, 'bad rational, zero denominator']]){
+			assert.throws(
+				() => {
+					Rational(arg);
+				},
+				(err) => {
+					assert(err instanceof type, `Rational(${arg})`);
+					assert.strictEqual(err.message, `Rational: ${msg}`, `Rational(${arg})`);
+					return true;
+				}
+			);
+		}
+
+		assert.throws(() => Rational(1, 0), TypeError);
+	};
+	testData.desc = 'One argument constructor ... invalid test#8';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - String arguments ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			/* The constructor and the methods take the same "n/d" or "n" strings. */
+			assert.strictEqual(new R('1/2', '3').toString(), '1/6', name);
+			assert.strictEqual(new R('2', '-4/3').toString(), '-3/2', name);
+			assert.strictEqual(new R(1, 3).add('1/6').toString(), '1/2', name);
+			assert.strictEqual(new R(1, 3).sub('-1/6').toString(), '1/2', name);
+			assert.strictEqual(new R(1, 3).mul('3/2').toString(), '1/2', name);
+			assert.strictEqual(new R(1, 3).div('2/3').toString(), '1/2', name);
+			assert.strictEqual(new R(1, 3).selfAdd('1/6').toString(), '1/2', name);
+			assert.strictEqual(new R(1, 3).selfSub('-1/6').toString(), '1/2', name);
+			assert.strictEqual(new R(1, 3).selfMul('3/2').toString(), '1/2', name);
+			assert.strictEqual(new R(1, 3).selfDiv('2/3').toString(), '1/2', name);
+			assert.strictEqual(new R(2, 3).pow('2').toString(), '4/9', name);
+			assert.strictEqual(new R(2, 3).selfPow('-2').toString(), '9/4', name);
+			assert(new R(1, 3).lessThan('1/2'), name);
+			assert(new R(1, 3).greaterThan('1/4'), name);
+			assert(new R(1, 3).equalTo('2/6'), name);
+			assert(new R(1, 3).notEqualTo('1/2'), name);
+
+			const r = new R();
+			r.assign('-6/4');
+			assert.strictEqual(r.toString(), '-3/2', name);
+			r.assign('1/2', '1/4');
+			assert.strictEqual(r.toString(), '2/1', name);
+		}
+	};
+	testData.desc = 'String arguments ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - String arguments ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const r = new lib.Rational(1, 3);
+
+			for(const [fn, type, msg] of [
+				[() => r.add(' 1'),                       TypeError,  'invalid argument'],
+				[() => r.add('1abc'),                     TypeError,  'invalid argument'],
+				[() => r.add('1/'),                       TypeError,  'invalid argument'],
+				[() => r.add('1.5'),                      TypeError,  'invalid argument'],
+				[() => r.lessThan('x'),                   TypeError,  'invalid argument'],
+				[() => r.add('1/0'),                      TypeError,  'bad rational, zero denominator'],
+				[() => r.assign('1', '0/1'),              TypeError,  'bad rational, zero denominator'],
+				[() => new lib.Rational(' 1'),            TypeError,  'invalid argument'],
+				[() => new lib.Rational('1', 'x'),        TypeError,  'invalid argument'],
+				[() => r.pow('1/2'),                      TypeError,  'invalid argument'],
+				[() => r.add('9223372036854775808'),      RangeError, 'arithmetic overflow'],
+				[() => new lib.Rational('1/-9223372036854775809'), RangeError, 'arithmetic overflow']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof type, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+		}
+	};
+	testData.desc = 'String arguments ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
 	// TEST ### - Two argument constructor ... valid test#1
 	testData = {};
 	testData.method = () => {
@@ -415,6 +589,24 @@ function loadTestData(){
 	testData.skip = false;
 	suites.get(suiteDesc).push(testData);
 
+	// TEST ### - Two argument constructor ... valid test#6
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			assert.strictEqual(new lib.Rational(6n, -4n).toString(), '-3/2');
+			assert.strictEqual(new lib.Rational(6n, 4).toString(), '3/2');
+			assert.strictEqual(new lib.Rational(6, 4n).toString(), '3/2');
+
+			let r = new lib.Rational(1);
+			r.assign(6n, 4n);
+			assert.strictEqual(r.toString(), '3/2');
+		}
+	};
+	testData.desc = 'Two argument constructor ... valid test#6';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
 	// TEST ### - Two argument constructor ... invalid test#6
 	testData = {};
 	testData.method = () => {
@@ -1121,13 +1313,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational();
 		assert.throws(
 			() => {
-				r.selfAdd(1n);
+				r.selfAdd(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.selfAdd(1n)`);
+				assert(err instanceof RangeError, `rational_addon.selfAdd(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.selfAdd(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.selfAdd(2n ** 63n)`
 				);
 				return true;
 			}
@@ -1136,13 +1328,13 @@ function loadTestData(){
 		r = new rational_module.Rational();
 		assert.throws(
 			() => {
-				r.selfAdd(1n);
+				r.selfAdd(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.selfAdd(1n)`);
+				assert(err instanceof RangeError, `rational_module.selfAdd(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.selfAdd(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.selfAdd(2n ** 63n)`
 				);
 				return true;
 			}
@@ -1419,13 +1611,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational();
 		assert.throws(
 			() => {
-				r.selfSub(1n);
+				r.selfSub(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.selfSub(1n)`);
+				assert(err instanceof RangeError, `rational_addon.selfSub(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.selfSub(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.selfSub(2n ** 63n)`
 				);
 				return true;
 			}
@@ -1434,13 +1626,13 @@ function loadTestData(){
 		r = new rational_module.Rational();
 		assert.throws(
 			() => {
-				r.selfSub(1n);
+				r.selfSub(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.selfSub(1n)`);
+				assert(err instanceof RangeError, `rational_module.selfSub(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.selfSub(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.selfSub(2n ** 63n)`
 				);
 				return true;
 			}
@@ -1717,13 +1909,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational();
 		assert.throws(
 			() => {
-				r.selfMul(1n);
+				r.selfMul(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.selfMul(1n)`);
+				assert(err instanceof RangeError, `rational_addon.selfMul(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.selfMul(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.selfMul(2n ** 63n)`
 				);
 				return true;
 			}
@@ -1732,13 +1924,13 @@ function loadTestData(){
 		r = new rational_module.Rational();
 		assert.throws(
 			() => {
-				r.selfMul(1n);
+				r.selfMul(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.selfMul(1n)`);
+				assert(err instanceof RangeError, `rational_module.selfMul(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.selfMul(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.selfMul(2n ** 63n)`
 				);
 				return true;
 			}
@@ -2015,13 +2207,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational();
 		assert.throws(
 			() => {
-				r.selfDiv(1n);
+				r.selfDiv(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.selfDiv(1n)`);
+				assert(err instanceof RangeError, `rational_addon.selfDiv(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.selfDiv(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.selfDiv(2n ** 63n)`
 				);
 				return true;
 			}
@@ -2030,13 +2222,13 @@ function loadTestData(){
 		r = new rational_module.Rational();
 		assert.throws(
 			() => {
-				r.selfDiv(1n);
+				r.selfDiv(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.selfDiv(1n)`);
+				assert(err instanceof RangeError, `rational_module.selfDiv(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.selfDiv(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.selfDiv(2n ** 63n)`
 				);
 				return true;
 			}
@@ -2395,13 +2587,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.selfPow(1n);
+				r.selfPow(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.selfPow(1n)`);
+				assert(err instanceof RangeError, `rational_addon.selfPow(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.selfPow(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.selfPow(2n ** 63n)`
 				);
 				return true;
 			}
@@ -2410,13 +2602,13 @@ function loadTestData(){
 		r = new rational_module.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.selfPow(1n);
+				r.selfPow(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.selfPow(1n)`);
+				assert(err instanceof RangeError, `rational_module.selfPow(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.selfPow(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.selfPow(2n ** 63n)`
 				);
 				return true;
 			}
@@ -2465,6 +2657,36 @@ function loadTestData(){
 	testData.skip = false;
 	suites.get(suiteDesc).push(testData);
 
+	// TEST ### - Rational selfPow() ... invalid test#6
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const r = new lib.Rational(2);
+
+			/* A fractional exponent throws rather than being truncated. */
+			for(const arg of [2.5, -1.5, 0.5]){
+				assert.throws(
+					() => {
+						r.selfPow(arg);
+					},
+					(err) => {
+						assert(err instanceof TypeError, `${name}.selfPow(${arg})`);
+						assert.strictEqual(err.message, `Rational: invalid argument`, `${name}.selfPow(${arg})`);
+						return true;
+					}
+				);
+			}
+
+			assert.strictEqual(r.toString(), '2/1', name);
+			assert.strictEqual(r.selfPow(3.0).toString(), '8/1', name);
+		}
+	};
+	testData.desc = 'Rational selfPow() ... invalid test#6';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
 	// TEST SUITE #8 - Rational add() function
 	suiteDesc = 'Rational add() function';
 	suites.set(suiteDesc, []);
@@ -2717,13 +2939,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational();
 		assert.throws(
 			() => {
-				r.add(1n);
+				r.add(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.add(1n)`);
+				assert(err instanceof RangeError, `rational_addon.add(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.add(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.add(2n ** 63n)`
 				);
 				return true;
 			}
@@ -2732,13 +2954,13 @@ function loadTestData(){
 		r = new rational_module.Rational();
 		assert.throws(
 			() => {
-				r.add(1n);
+				r.add(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.add(1n)`);
+				assert(err instanceof RangeError, `rational_module.add(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.add(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.add(2n ** 63n)`
 				);
 				return true;
 			}
@@ -3039,13 +3261,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational();
 		assert.throws(
 			() => {
-				r.sub(1n);
+				r.sub(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.sub(1n)`);
+				assert(err instanceof RangeError, `rational_addon.sub(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.sub(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.sub(2n ** 63n)`
 				);
 				return true;
 			}
@@ -3054,13 +3276,13 @@ function loadTestData(){
 		r = new rational_module.Rational();
 		assert.throws(
 			() => {
-				r.sub(1n);
+				r.sub(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.sub(1n)`);
+				assert(err instanceof RangeError, `rational_module.sub(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.sub(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.sub(2n ** 63n)`
 				);
 				return true;
 			}
@@ -3361,13 +3583,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational();
 		assert.throws(
 			() => {
-				r.mul(1n);
+				r.mul(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.mul(1n)`);
+				assert(err instanceof RangeError, `rational_addon.mul(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.mul(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.mul(2n ** 63n)`
 				);
 				return true;
 			}
@@ -3376,13 +3598,13 @@ function loadTestData(){
 		r = new rational_module.Rational();
 		assert.throws(
 			() => {
-				r.mul(1n);
+				r.mul(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.mul(1n)`);
+				assert(err instanceof RangeError, `rational_module.mul(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.mul(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.mul(2n ** 63n)`
 				);
 				return true;
 			}
@@ -3683,13 +3905,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational();
 		assert.throws(
 			() => {
-				r.div(1n);
+				r.div(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.div(1n)`);
+				assert(err instanceof RangeError, `rational_addon.div(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.div(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.div(2n ** 63n)`
 				);
 				return true;
 			}
@@ -3698,13 +3920,13 @@ function loadTestData(){
 		r = new rational_module.Rational();
 		assert.throws(
 			() => {
-				r.div(1n);
+				r.div(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.div(1n)`);
+				assert(err instanceof RangeError, `rational_module.div(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.div(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.div(2n ** 63n)`
 				);
 				return true;
 			}
@@ -4103,13 +4325,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.pow(1n);
+				r.pow(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.pow(1n)`);
+				assert(err instanceof RangeError, `rational_addon.pow(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.pow(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.pow(2n ** 63n)`
 				);
 				return true;
 			}
@@ -4118,13 +4340,13 @@ function loadTestData(){
 		r = new rational_module.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.pow(1n);
+				r.pow(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.pow(1n)`);
+				assert(err instanceof RangeError, `rational_module.pow(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.pow(1n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.pow(2n ** 63n)`
 				);
 				return true;
 			}
@@ -4173,6 +4395,36 @@ function loadTestData(){
 	testData.skip = false;
 	suites.get(suiteDesc).push(testData);
 
+	// TEST ### - Rational pow() ... invalid test#6
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const r = new lib.Rational(2);
+
+			/* A fractional exponent throws rather than being truncated. */
+			for(const arg of [2.5, -1.5, 0.5]){
+				assert.throws(
+					() => {
+						r.pow(arg);
+					},
+					(err) => {
+						assert(err instanceof TypeError, `${name}.pow(${arg})`);
+						assert.strictEqual(err.message, `Rational: invalid argument`, `${name}.pow(${arg})`);
+						return true;
+					}
+				);
+			}
+
+			assert.strictEqual(r.toString(), '2/1', name);
+			assert.strictEqual(r.pow(3.0).toString(), '8/1', name);
+		}
+	};
+	testData.desc = 'Rational pow() ... invalid test#6';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
 	// TEST SUITE #13 - Rational preInc() function
 	suiteDesc = 'Rational preInc() function';
 	suites.set(suiteDesc, []);
@@ -5419,13 +5671,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.lessThan(2n);
+				r.lessThan(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.lessThan(2n)`);
+				assert(err instanceof RangeError, `rational_addon.lessThan(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.lessThan(2n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.lessThan(2n ** 63n)`
 				);
 				return true;
 			}
@@ -5434,13 +5686,13 @@ function loadTestData(){
 		r = new rational_module.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.lessThan(2n);
+				r.lessThan(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.lessThan(2n)`);
+				assert(err instanceof RangeError, `rational_module.lessThan(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.lessThan(2n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.lessThan(2n ** 63n)`
 				);
 				return true;
 			}
@@ -5729,13 +5981,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.greaterThan(2n);
+				r.greaterThan(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.greaterThan(2n)`);
+				assert(err instanceof RangeError, `rational_addon.greaterThan(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.greaterThan(2n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.greaterThan(2n ** 63n)`
 				);
 				return true;
 			}
@@ -5744,13 +5996,13 @@ function loadTestData(){
 		r = new rational_module.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.greaterThan(2n);
+				r.greaterThan(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.greaterThan(2n)`);
+				assert(err instanceof RangeError, `rational_module.greaterThan(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.greaterThan(2n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.greaterThan(2n ** 63n)`
 				);
 				return true;
 			}
@@ -6039,13 +6291,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.equalTo(2n);
+				r.equalTo(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.equalTo(2n)`);
+				assert(err instanceof RangeError, `rational_addon.equalTo(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.equalTo(2n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.equalTo(2n ** 63n)`
 				);
 				return true;
 			}
@@ -6054,13 +6306,13 @@ function loadTestData(){
 		r = new rational_module.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.equalTo(2n);
+				r.equalTo(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.equalTo(2n)`);
+				assert(err instanceof RangeError, `rational_module.equalTo(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.equalTo(2n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.equalTo(2n ** 63n)`
 				);
 				return true;
 			}
@@ -6349,13 +6601,13 @@ function loadTestData(){
 		let r = new rational_addon.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.notEqualTo(2n);
+				r.notEqualTo(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_addon.notEqualTo(2n)`);
+				assert(err instanceof RangeError, `rational_addon.notEqualTo(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_addon.notEqualTo(2n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.notEqualTo(2n ** 63n)`
 				);
 				return true;
 			}
@@ -6364,13 +6616,13 @@ function loadTestData(){
 		r = new rational_module.Rational(3, 2);
 		assert.throws(
 			() => {
-				r.notEqualTo(2n);
+				r.notEqualTo(2n ** 63n);
 			},
 			(err) => {
-				assert(err instanceof TypeError, `rational_module.notEqualTo(2n)`);
+				assert(err instanceof RangeError, `rational_module.notEqualTo(2n ** 63n)`);
 				assert.strictEqual(
-					err.message, `Rational: BigInt type is not accepted`,
-					`rational_module.notEqualTo(2n)`
+					err.message, `Rational: arithmetic overflow`,
+					`rational_module.notEqualTo(2n ** 63n)`
 				);
 				return true;
 			}
@@ -6583,6 +6835,1770 @@ function loadTestData(){
 
 	testData.skip = false;
 	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #29 - Rational arithmetic overflow
+	suiteDesc = 'Rational arithmetic overflow';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rational arithmetic overflow ... valid test#1
+	testData = {};
+	testData.method = () => {
+		let r = new rational_addon.Rational(2 ** 52, 3);
+		r.selfMul(4).selfDiv(4);
+		assert.strictEqual(r.getNumerator(), 2 ** 52);
+		assert.strictEqual(r.getDenominator(), 3);
+
+		r = new rational_addon.Rational(2 ** 40, 3).add(new rational_addon.Rational(2 ** 40, 3));
+		assert.strictEqual(r.getNumerator(), 2 ** 41);
+		assert.strictEqual(r.getDenominator(), 3);
+	};
+	testData.desc = 'Rational arithmetic overflow ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational arithmetic overflow ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		let r = new rational_addon.Rational(2 ** 62);
+		assert.throws(
+			() => {
+				r.selfMul(4);
+			},
+			(err) => {
+				assert(err instanceof RangeError, `rational_addon.selfMul(4)`);
+				assert.strictEqual(
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.selfMul(4)`
+				);
+				return true;
+			}
+		);
+		assert.strictEqual(r.getNumerator(), 2 ** 62);
+		assert.strictEqual(r.getDenominator(), 1);
+	};
+	testData.desc = 'Rational arithmetic overflow ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational arithmetic overflow ... invalid test#2
+	testData = {};
+	testData.method = () => {
+		let r = new rational_addon.Rational(1, 2 ** 62);
+		assert.throws(
+			() => {
+				r.add(new rational_addon.Rational(1, 3));
+			},
+			(err) => {
+				assert(err instanceof RangeError, `rational_addon.add(new Rational(1, 3))`);
+				assert.strictEqual(
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.add(new Rational(1, 3))`
+				);
+				return true;
+			}
+		);
+
+		assert.throws(
+			() => {
+				r.pow(2);
+			},
+			(err) => {
+				assert(err instanceof RangeError, `rational_addon.pow(2)`);
+				assert.strictEqual(
+					err.message, `Rational: arithmetic overflow`,
+					`rational_addon.pow(2)`
+				);
+				return true;
+			}
+		);
+	};
+	testData.desc = 'Rational arithmetic overflow ... invalid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational arithmetic overflow ... valid test#2
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			assert.strictEqual(new lib.Rational(-1).pow(1e9 + 1).toString(), '-1/1');
+			assert.strictEqual(new lib.Rational(1).selfPow(-1e9).toString(), '1/1');
+			assert.strictEqual(new lib.Rational(0).pow(1e9).toString(), '0/1');
+			assert.strictEqual(new lib.Rational(-2, 3).pow(-5).toString(), '-243/32');
+			assert.strictEqual(new lib.Rational(2).selfPow('52').toString(), `${2 ** 52}/1`);
+		}
+	};
+	testData.desc = 'Rational arithmetic overflow ... valid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational arithmetic overflow ... invalid test#3
+	testData = {};
+	testData.method = () => {
+		for(const method of ['pow', 'selfPow']){
+			let r = new rational_addon.Rational(3, 2);
+			assert.throws(
+				() => {
+					r[method](1e9);
+				},
+				(err) => {
+					assert(err instanceof RangeError, `rational_addon.${method}(1e9)`);
+					assert.strictEqual(
+						err.message, `Rational: arithmetic overflow`,
+						`rational_addon.${method}(1e9)`
+					);
+					return true;
+				}
+			);
+			assert.strictEqual(r.toString(), '3/2');
+		}
+	};
+	testData.desc = 'Rational arithmetic overflow ... invalid test#3';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #30 - Accumulator
+	suiteDesc = 'Accumulator';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Accumulator ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			let a = new lib.Accumulator();
+			let r = new lib.Rational();
+
+			for(let i = 1; i <= 100; i++){
+				a.add(new lib.Rational(i % 7 - 3, i % 11 + 1));
+				r.selfAdd(new lib.Rational(i % 7 - 3, i % 11 + 1));
+			}
+
+			let v = a.value();
+
+			assert(v instanceof lib.Rational);
+			assert.strictEqual(v.getNumerator(), r.getNumerator());
+			assert.strictEqual(v.getDenominator(), r.getDenominator());
+		}
+	};
+	testData.desc = 'Accumulator ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Accumulator ... valid test#2
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			let a = new lib.Accumulator(new lib.Rational(1, 2));
+			let s = a.add('3').sub(1.5).mul(new lib.Rational(3, 4)).div(-2);
+
+			assert(a === s);
+			assert.strictEqual(a.value().toString(), '-3/4');
+
+			a.reset();
+			assert.strictEqual(a.value().toString(), '0/1');
+
+			a.reset(new lib.Rational(2, 3)).add(new lib.Rational(1, 3));
+			assert.strictEqual(a.value().toString(), '1/1');
+		}
+	};
+	testData.desc = 'Accumulator ... valid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Accumulator ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			let a = new lib.Accumulator(new lib.Rational(1, 2));
+
+			for(const [arg, type, msg] of [[{}, TypeError, 'invalid argument'], ['abc', TypeError, 'invalid argument'], [2n ** 63n, RangeError, 'arithmetic overflow']]){
+				assert.throws(
+					() => {
+						a.add(arg);
+					},
+					(err) => {
+						assert(err instanceof type, `Accumulator.add(${typeof arg})`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `Accumulator.add(${typeof arg})`);
+						return true;
+					}
+				);
+			}
+
+			assert.throws(
+				() => {
+					a.div(0);
+				},
+				(err) => {
+					assert(err instanceof TypeError, `Accumulator.div(0)`);
+					assert.strictEqual(err.message, `Rational: division by zero`, `Accumulator.div(0)`);
+					return true;
+				}
+			);
+
+			assert.throws(
+				() => {
+					a.mul();
+				},
+				(err) => {
+					assert(err instanceof TypeError, `Accumulator.mul()`);
+					assert.strictEqual(err.message, `Rational: invalid number of arguments`, `Accumulator.mul()`);
+					return true;
+				}
+			);
+
+			assert.strictEqual(a.value().toString(), '1/2');
+		}
+	};
+	testData.desc = 'Accumulator ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Accumulator ... invalid test#2
+	testData = {};
+	testData.method = () => {
+		const Accumulator = rational_addon.Accumulator;
+
+		/* Called without 'new', the constructor throws the same exceptions. */
+		assert.strictEqual(Accumulator(new rational_addon.Rational(1, 2)).value().toString(), '1/2');
+
+		for(const [arg, type, msg] of [[{}, TypeError, 'invalid argument'], ['abc', TypeError, 'invalid argument'], [2n ** 70n, RangeError, 'arithmetic overflow']]){
+			assert.throws(
+				() => {
+					Accumulator(arg);
+				},
+				(err) => {
+					assert(err instanceof type, `Accumulator(${typeof arg})`);
+					assert.strictEqual(err.message, `Rational: ${msg}`, `Accumulator(${typeof arg})`);
+					return true;
+				}
+			);
+		}
+	};
+	testData.desc = 'Accumulator ... invalid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #31 - Rational reduceAsync() function
+	suiteDesc = 'Rational reduceAsync() function';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rational reduceAsync() function ... valid test#1
+	testData = {};
+	testData.method = async () => {
+		for(const lib of [rational_addon, rational_module]){
+			let values = [];
+			for(let i = 1; i <= 10000; i++)
+				values.push(new lib.Rational(i % 7 - 3, i % 12 + 1));
+
+			let s = new lib.Rational();
+			for(const v of values)
+				s.selfAdd(v);
+
+			let r = await lib.Rational.reduceAsync(values, 'sum');
+
+			assert(r instanceof lib.Rational);
+			assert.strictEqual(r.toString(), s.toString());
+
+			assert.strictEqual((await lib.Rational.reduceAsync(values, 'min')).toString(), '-3/1');
+			assert.strictEqual((await lib.Rational.reduceAsync(values, 'max')).toString(), '3/1');
+			assert.strictEqual((await lib.Rational.reduceAsync([new lib.Rational(2, 3), 3, '-5'], 'product')).toString(), '-10/1');
+		}
+	};
+	testData.desc = 'Rational reduceAsync() function ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational reduceAsync() function ... valid test#2
+	testData = {};
+	testData.method = async () => {
+		for(const lib of [rational_addon, rational_module]){
+			assert.strictEqual((await lib.Rational.reduceAsync([], 'sum')).toString(), '0/1');
+			assert.strictEqual((await lib.Rational.reduceAsync([], 'product')).toString(), '1/1');
+			assert.strictEqual((await lib.Rational.reduceAsync([new lib.Rational(1, 2)], 'min')).toString(), '1/2');
+
+			let p = lib.Rational.reduceAsync([1, 2], 'sum');
+			assert(p instanceof Promise);
+			assert.strictEqual((await p).toString(), '3/1');
+		}
+	};
+	testData.desc = 'Rational reduceAsync() function ... valid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational reduceAsync() function ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			for(const args of [[[1], 'mean'], [{}, 'sum'], [[{}], 'sum'], [[], 'min'], [[], 'max']]){
+				assert.throws(
+					() => {
+						lib.Rational.reduceAsync(...args);
+					},
+					(err) => {
+						assert(err instanceof TypeError, `Rational.reduceAsync(${args[1]})`);
+						assert.strictEqual(err.message, `Rational: invalid argument`, `Rational.reduceAsync(${args[1]})`);
+						return true;
+					}
+				);
+			}
+
+			assert.throws(
+				() => {
+					lib.Rational.reduceAsync([1]);
+				},
+				(err) => {
+					assert(err instanceof TypeError, `Rational.reduceAsync()`);
+					assert.strictEqual(err.message, `Rational: invalid number of arguments`, `Rational.reduceAsync()`);
+					return true;
+				}
+			);
+		}
+	};
+	testData.desc = 'Rational reduceAsync() function ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational reduceAsync() function ... invalid test#2
+	testData = {};
+	testData.method = async () => {
+		let values = [];
+		for(let i = 0; i < 8192; i++)
+			values.push(new rational_addon.Rational(2 ** 40));
+
+		await assert.rejects(
+			rational_addon.Rational.reduceAsync(values, 'product'),
+			(err) => {
+				assert(err instanceof RangeError);
+				assert.strictEqual(err.message, 'Rational: arithmetic overflow');
+				return true;
+			}
+		);
+	};
+	testData.desc = 'Rational reduceAsync() function ... invalid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #32 - Rational brand check
+	suiteDesc = 'Rational brand check';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rational brand check ... valid test#1
+	testData = {};
+	testData.method = () => {
+		class Derived extends rational_addon.Rational{}
+
+		let r = new rational_addon.Rational(1, 2);
+		let s = new Derived(1, 3);
+
+		assert.strictEqual(r.add(s).toString(), '5/6');
+		assert.strictEqual(new rational_addon.Rational(s).toString(), '1/3');
+		assert.strictEqual(r.selfMul(r).toString(), '1/4');
+		assert(s.lessThan(r) === false && r.lessThan(s) === true);
+		assert.strictEqual(new rational_addon.Accumulator(s).add(s).value().toString(), '2/3');
+	};
+	testData.desc = 'Rational brand check ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational brand check ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		const Rational = class Rational{
+			constructor(){
+				this.num = 1;
+				this.den = 2;
+			}
+		};
+		const spoofs = [new Rational(), new rational_module.Rational(1, 2), Object.create(rational_addon.Rational.prototype)];
+
+		let r = new rational_addon.Rational(1, 3);
+
+		for(const spoof of spoofs){
+			for(const [desc, f] of [
+				['Rational()',    () => new rational_addon.Rational(spoof)],
+				['assign()',      () => r.assign(spoof)],
+				['selfAdd()',     () => r.selfAdd(spoof)],
+				['sub()',         () => r.sub(spoof)],
+				['selfDiv()',     () => r.selfDiv(spoof)],
+				['equalTo()',     () => r.equalTo(spoof)],
+				['Accumulator()', () => new rational_addon.Accumulator(spoof)]
+			]){
+				assert.throws(
+					f,
+					(err) => {
+						assert(err instanceof TypeError, `rational_addon.${desc}`);
+						assert.strictEqual(err.message, `Rational: invalid argument`, `rational_addon.${desc}`);
+						return true;
+					}
+				);
+			}
+		}
+
+		assert.strictEqual(r.toString(), '1/3');
+	};
+	testData.desc = 'Rational brand check ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #33 - Rational result objects
+	suiteDesc = 'Rational result objects';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rational result objects ... valid test#1
+	testData = {};
+	testData.method = () => {
+		let r = new rational_addon.Rational(-1, 3);
+
+		for(const [desc, res, str] of [
+			['add()',     r.add(1),                                   '2/3'],
+			['sub()',     r.sub('1'),                                 '-4/3'],
+			['mul()',     r.mul(r),                                   '1/9'],
+			['div()',     r.div(new rational_addon.Rational(1, 6)),   '-2/1'],
+			['pow()',     r.pow(-2),                                  '9/1'],
+			['neg()',     r.neg(),                                    '1/3'],
+			['abs()',     r.abs(),                                    '1/3'],
+			['postInc()', r.postInc(),                                '-1/3'],
+			['postDec()', r.postDec(),                                '2/3'],
+			['value()',   new rational_addon.Accumulator(r).value(),  '-1/3']
+		]){
+			assert(res instanceof rational_addon.Rational, `rational_addon.${desc}`);
+			assert(res !== r, `rational_addon.${desc}`);
+			assert.strictEqual(res.toString(), str, `rational_addon.${desc}`);
+			assert.strictEqual(`${res.num}/${res.den}`, str, `rational_addon.${desc}`);
+			assert.strictEqual(new rational_addon.Rational(res).mul(2).toString(), res.selfAdd(res).toString(), `rational_addon.${desc}`);
+		}
+
+		assert.strictEqual(r.toString(), '-1/3');
+	};
+	testData.desc = 'Rational result objects ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #34 - Rational worker threads
+	suiteDesc = 'Rational worker threads';
+	suites.set(suiteDesc, []);
+
+	/* Runs the given source in a worker requiring the addon, resolving to its first message. */
+	const runWorker = (source, workerData) => new Promise((resolve, reject) => {
+		const worker = new Worker(
+			`const { parentPort, workerData } = require('node:worker_threads');
+			 const { Rational, Accumulator } = require(${JSON.stringify(require.resolve('../build/Release/rational'))});
+			 ${source}`,
+			{ eval: true, workerData }
+		);
+		worker.once('message', (msg) => resolve([worker, msg]));
+		worker.once('error', reject);
+	});
+
+	// TEST ### - Rational worker threads ... valid test#1
+	testData = {};
+	testData.method = async () => {
+		const workers = 4;
+		const source = `
+			const values = [];
+			for(let i = 1; i <= 20000; i++)
+				values.push(new Rational(i % 7 - 3, (i + workerData) % 12 + 1));
+
+			let s = new Rational();
+			for(const v of values)
+				s.selfAdd(v);
+
+			Rational.reduceAsync(values, 'sum').then((r) => parentPort.postMessage(
+				[s.toString(), r.toString(), new Accumulator(s).mul(Rational(1, 2)).value().toString()]
+			));`;
+
+		const pending = [];
+		for(let w = 0; w < workers; w++)
+			pending.push(runWorker(source, w));
+
+		for(let w = 0; w < workers; w++){
+			let s = new rational_addon.Rational();
+			for(let i = 1; i <= 20000; i++)
+				s.selfAdd(new rational_addon.Rational(i % 7 - 3, (i + w) % 12 + 1));
+
+			const [worker, msg] = await pending[w];
+			await worker.terminate();
+
+			assert.deepStrictEqual(msg, [s.toString(), s.toString(), s.div(2).toString()], `worker #${w}`);
+		}
+	};
+	testData.desc = 'Rational worker threads ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational worker threads ... valid test#2
+	testData = {};
+	testData.method = async () => {
+		/* A worker stopped with reductions still running on the threadpool. */
+		const [worker] = await runWorker(`
+			const values = Array.from({ length: 200000 }, (_, i) => new Rational(1, i % 7 + 1));
+			Rational.reduceAsync(values, 'sum');
+			Rational.reduceAsync(values, 'max');
+			parentPort.postMessage('started');`
+		);
+		await worker.terminate();
+
+		const [other, msg] = await runWorker(`parentPort.postMessage(new Rational(1, 2).add(Rational(1, 3)).toString());`);
+		await other.terminate();
+
+		assert.strictEqual(msg, '5/6');
+		assert.strictEqual(new rational_addon.Rational(1, 2).add(new rational_addon.Rational(1, 3)).toString(), '5/6');
+		assert.strictEqual((await rational_addon.Rational.reduceAsync([1, '2', new rational_addon.Rational(1, 2)], 'sum')).toString(), '7/2');
+	};
+	testData.desc = 'Rational worker threads ... valid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational worker threads ... invalid test#1
+	testData = {};
+	testData.method = async () => {
+		/* A Rational cannot be posted to another thread, its text can. */
+		const [worker, msg] = await runWorker(`
+			const r = new Rational(-2, 6);
+			try{
+				parentPort.postMessage(r);
+			}
+			catch(err){
+				parentPort.postMessage([err.name, r.toString()]);
+			}`
+		);
+		await worker.terminate();
+
+		assert.strictEqual(msg[0], 'DataCloneError');
+		assert(new rational_addon.Rational(msg[1]).equalTo(new rational_addon.Rational(-1, 3)));
+	};
+	testData.desc = 'Rational worker threads ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #35 - BigRational
+	suiteDesc = 'BigRational';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - BigRational ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			assert.strictEqual(new lib.BigRational().toString(), '0/1');
+			assert.strictEqual(new lib.BigRational(6n, -4n).toString(), '-3/2');
+			assert.strictEqual(new lib.BigRational(-6, 4).toString(), '-3/2');
+			assert.strictEqual(new lib.BigRational('-6/4').toString(), '-3/2');
+			assert.strictEqual(new lib.BigRational(new lib.Rational(2, 6)).toString(), '1/3');
+			assert.strictEqual(new lib.BigRational(new lib.BigRational(7n)).toString(), '7/1');
+
+			let r = new lib.BigRational(2n ** 100n, 3n);
+			assert.strictEqual(r.getNumerator(), 2n ** 100n, `${lib === rational_addon ? 'addon' : 'module'}.getNumerator()`);
+			assert.strictEqual(r.getDenominator(), 3n, `${lib === rational_addon ? 'addon' : 'module'}.getDenominator()`);
+			assert.strictEqual(r.valueOf(), 2 ** 100 / 3);
+			assert(new lib.BigRational(r.toString()).equalTo(r));
+
+			r.assign(2n ** 126n + 1n, -(2n ** 64n));
+			assert.strictEqual(r.toString(), `${-(2n ** 126n + 1n)}/${2n ** 64n}`);
+
+			assert.strictEqual(new lib.BigRational(-(3n ** 200n), 6n ** 100n).toString(), `${-(3n ** 100n)}/${2n ** 100n}`);
+			assert.strictEqual(new lib.BigRational(`+${2n ** 300n}/-${4n ** 100n}`).toString(), `${-(2n ** 100n)}/1`);
+			assert.strictEqual(new lib.BigRational(2 ** 80 + 2 ** 40).toString(), `${2n ** 80n + 2n ** 40n}/1`);
+			assert.strictEqual(new lib.BigRational(-1e300).getNumerator(), BigInt(-1e300));
+		}
+	};
+	testData.desc = 'BigRational ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - BigRational ... valid test#2
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const a = new lib.BigRational(2n ** 80n, 3n);
+			const b = new lib.BigRational(5n, 2n ** 40n);
+
+			assert.strictEqual(a.add(b).toString(), `${2n ** 120n + 15n}/${3n * 2n ** 40n}`);
+			assert.strictEqual(a.sub(b).toString(), `${2n ** 120n - 15n}/${3n * 2n ** 40n}`);
+			assert.strictEqual(a.mul(b).toString(), `${5n * 2n ** 40n}/3`);
+			assert.strictEqual(a.div(b).toString(), `${2n ** 120n}/15`);
+			assert.strictEqual(new lib.BigRational(-2, 3).pow(3).toString(), '-8/27');
+			assert.strictEqual(new lib.BigRational(2, 3).pow(-2n).toString(), '9/4');
+			assert.strictEqual(new lib.BigRational(2).pow(1000).toString(), `${2n ** 1000n}/1`);
+			assert.strictEqual(new lib.BigRational(-1).pow(2n ** 62n).toString(), '1/1');
+			assert.strictEqual(a.mul(a).mul(a).div(a).div(a).toString(), a.toString());
+			assert.strictEqual(a.neg().abs().toString(), a.toString());
+
+			assert(b.lessThan(a) && a.greaterThan(b) && a.notEqualTo(b));
+			assert(a.equalTo(`${2n ** 80n}/3`));
+			assert(new lib.BigRational(1, 2).equalTo(new lib.Rational(1, 2)));
+			assert(new lib.BigRational(1, 2).lessThan(1n));
+
+			let r = new lib.BigRational(1, 2);
+			assert.strictEqual(r.selfAdd(1).selfSub('1/4').selfMul(4n).selfDiv(new lib.Rational(1, 3)).selfPow(2), r);
+			assert.strictEqual(r.toString(), '225/1');
+		}
+	};
+	testData.desc = 'BigRational ... valid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - BigRational ... valid test#3
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const B = lib.BigRational;
+
+			/* Fractional numbers taken as the exact values of the doubles, as by Rational. */
+			assert.strictEqual(new B(1.5).toString(), '3/2', name);
+			assert.strictEqual(new B(-0.75).toString(), '-3/4', name);
+			assert.strictEqual(new B(0.1).toString(), '3602879701896397/36028797018963968', name);
+			assert.strictEqual(new B(5e-324).toString(), `1/${2n ** 1074n}`, name);
+			assert.strictEqual(new B(1.5).toString(), new lib.Rational(1.5).toString(), name);
+
+			assert.strictEqual(new B(1.5, 2).toString(), '3/4', name);
+			assert.strictEqual(new B(1, 0.5).toString(), '2/1', name);
+			assert.strictEqual(new B(0.5, 0.25).toString(), '2/1', name);
+
+			assert.strictEqual(new B(1, 2).add(0.5).toString(), '1/1', name);
+			assert.strictEqual(new B(1, 2).sub(0.25).toString(), '1/4', name);
+			assert.strictEqual(new B(1, 2).mul(0.5).toString(), '1/4', name);
+			assert.strictEqual(new B(1, 2).div(0.25).toString(), '2/1', name);
+			assert.strictEqual(new B(1, 2).selfAdd(0.5).selfMul(0.75).selfSub(0.125).selfDiv(1.25).toString(), '1/2', name);
+			assert(new B(1, 2).equalTo(0.5) && new B(1, 3).lessThan(0.5) && new B(2, 3).greaterThan(0.5), name);
+
+			const r = new B();
+			r.assign(2.5);
+			assert.strictEqual(r.toString(), '5/2', name);
+			r.assign(2.5, 0.5);
+			assert.strictEqual(r.toString(), '5/1', name);
+		}
+	};
+	testData.desc = 'BigRational ... valid test#3';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - BigRational ... valid test#4
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const B = lib.BigRational;
+
+			/* Large BigInt values round trip through the 64-bit words. */
+			const big = 7n ** 100000n + 2n ** 64n;
+			assert.strictEqual(new B(big).getNumerator(), big, name);
+			assert.strictEqual(new B(-big, 2n ** 64n + 1n).getNumerator(), -big, name);
+			assert.strictEqual(new B(-big, 2n ** 64n + 1n).getDenominator(), 2n ** 64n + 1n, name);
+			assert.strictEqual(new B(-(2n ** 63n)).getNumerator(), -(2n ** 63n), name);
+
+			/* Powers of terms up to 2^18 bits. */
+			assert.strictEqual(new B(2).pow(2 ** 18).getNumerator(), 2n ** 262144n, name);
+			assert.strictEqual(new B(1, 2).pow(-(2 ** 18)).getNumerator(), 2n ** 262144n, name);
+			assert.strictEqual(new B(3).pow(165000).getNumerator(), 3n ** 165000n, name);
+		}
+	};
+	testData.desc = 'BigRational ... valid test#4';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - BigRational ... valid test#5
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const B = lib.BigRational;
+
+			/* Terms beyond 2^1024 give the nearest number to the quotient. */
+			assert.strictEqual(new B(2n ** 2000n + 1n, 2n ** 1999n).valueOf(), 2, name);
+			assert.strictEqual(new B(10n ** 400n, 3n * 10n ** 399n).valueOf(), 10 / 3, name);
+			assert.strictEqual(new B(1n, 3n ** 600n).valueOf(), 5.336385165377108e-287, name);
+			assert.strictEqual(new B(-(3n ** 700n), 2n ** 100n).valueOf(), -7.61866253907264e+303, name);
+
+			/* Subnormal results, rounded once. */
+			assert.strictEqual(new B(1n, 3n ** 670n).valueOf(), 2.132e-320, name);
+			assert.strictEqual(new B(7n, 3n * 2n ** 1074n).valueOf(), 1e-323, name);
+			assert.strictEqual(new B(1n, 2n ** 1076n).valueOf(), 0, name);
+
+			/* Ties to even, up to the largest number. */
+			assert.strictEqual(new B(2n ** 53n + 1n).valueOf(), 2 ** 53, name);
+			assert.strictEqual(new B(2n ** 53n + 3n).valueOf(), 2 ** 53 + 4, name);
+			assert.strictEqual(new B(2n ** 1024n - 2n ** 971n - 1n).valueOf(), Number.MAX_VALUE, name);
+			assert.strictEqual(new B(2n ** 1024n - 2n ** 970n).valueOf(), Infinity, name);
+			assert.strictEqual(new B(-(2n ** 1100n), 3n).valueOf(), -Infinity, name);
+		}
+	};
+	testData.desc = 'BigRational ... valid test#5';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - BigRational ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+
+			for(const [f, type, msg] of [
+				[() => new lib.BigRational(3).pow(2 ** 30),                RangeError, 'arithmetic overflow'],
+				[() => new lib.BigRational(1, 2n ** 64n).pow(-(2 ** 25)),  RangeError, 'arithmetic overflow'],
+				[() => new lib.BigRational(2).pow(2n ** 64n),              RangeError, 'arithmetic overflow'],
+				[() => new lib.BigRational(2).pow(2 ** 18 + 1),            RangeError, 'arithmetic overflow'],
+				[() => new lib.BigRational(3).pow(166000),                 RangeError, 'arithmetic overflow'],
+				[() => new lib.BigRational(2n ** 1000n).pow(263),          RangeError, 'arithmetic overflow'],
+				[() => new lib.BigRational(1, 0n),                         TypeError,  'bad rational, zero denominator'],
+				[() => new lib.BigRational('1/0'),                         TypeError,  'bad rational, zero denominator'],
+				[() => new lib.BigRational(1).div(0n),                     TypeError,  'division by zero'],
+				[() => new lib.BigRational(0).pow(-1),                     TypeError,  'division by zero'],
+				[() => new lib.BigRational('abc'),                         TypeError,  'invalid argument'],
+				[() => new lib.BigRational({}),                            TypeError,  'invalid argument'],
+				[() => new lib.BigRational(NaN),                           TypeError,  'invalid argument'],
+				[() => new lib.BigRational(Infinity),                      TypeError,  'invalid argument'],
+				[() => new lib.BigRational('1/2/3'),                       TypeError,  'invalid argument'],
+				[() => new lib.BigRational(1).pow('2'),                    TypeError,  'invalid argument'],
+				[() => new lib.BigRational(1).pow(1.5),                    TypeError,  'invalid argument'],
+				[() => new lib.BigRational(1, 0.0),                        TypeError,  'bad rational, zero denominator'],
+				[() => new lib.BigRational(1, 2, 3),                       TypeError,  'invalid number of arguments'],
+				[() => new lib.BigRational(1).add(),                       TypeError,  'invalid number of arguments']
+			]){
+				assert.throws(
+					f,
+					(err) => {
+						assert(err instanceof type, `${name}: ${f}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${f}`);
+						return true;
+					}
+				);
+			}
+		}
+	};
+	testData.desc = 'BigRational ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - BigRational ... invalid test#2
+	testData = {};
+	testData.method = () => {
+		const BigRational = rational_addon.BigRational;
+
+		/* Called without 'new', the constructor throws the same exceptions. */
+		assert.strictEqual(BigRational(2n ** 70n, 4n).toString(), `${2n ** 68n}/1`);
+
+		for(const [f, type, msg] of [
+			[() => BigRational(1, 0n),  TypeError, 'bad rational, zero denominator'],
+			[() => BigRational('abc'),  TypeError, 'invalid argument'],
+			[() => BigRational(NaN),    TypeError, 'invalid argument']
+		]){
+			assert.throws(
+				f,
+				(err) => {
+					assert(err instanceof type, `rational_addon: ${f}`);
+					assert.strictEqual(err.message, `Rational: ${msg}`, `rational_addon: ${f}`);
+					return true;
+				}
+			);
+		}
+	};
+	testData.desc = 'BigRational ... invalid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #36 - Rational typed array batch methods
+	suiteDesc = 'Rational typed array batch methods';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rational typed array batch methods ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+
+			for(const [kind, of] of [[Int32Array, Number], [BigInt64Array, BigInt], [Float64Array, Number]]){
+				const an = kind.from([1, -1, 2, 0, 7].map(of)), ad = kind.from([2, 3, 3, 1, 5].map(of));
+				const bn = kind.from([1, 1, -4, 5, 7].map(of)), bd = kind.from([3, 6, 9, 2, 5].map(of));
+
+				const rn = new kind(5), rd = new kind(5), c = new Int32Array(5);
+
+				const expect = (num, den) => {
+					assert.deepStrictEqual([...rn], num.map(of), `${name}: ${kind.name}`);
+					assert.deepStrictEqual([...rd], den.map(of), `${name}: ${kind.name}`);
+				};
+
+				assert.strictEqual(lib.Rational.addArrays(an, ad, bn, bd, rn, rd), undefined);
+				expect([5, -1, 2, 5, 14], [6, 6, 9, 2, 5]);
+
+				lib.Rational.subArrays(an, ad, bn, bd, rn, rd);
+				expect([1, -1, 10, -5, 0], [6, 2, 9, 2, 1]);
+
+				lib.Rational.mulArrays(an, ad, bn, bd, rn, rd);
+				expect([1, -1, -8, 0, 49], [6, 18, 27, 1, 25]);
+
+				lib.Rational.divArrays(an, ad, bn, bd, rn, rd);
+				expect([3, -2, -3, 0, 1], [2, 1, 2, 1, 1]);
+
+				lib.Rational.compareArrays(an, ad, bn, bd, c);
+				assert.deepStrictEqual([...c], [1, -1, 1, -1, 0], `${name}: ${kind.name}`);
+
+				/* Results stored over the first operands, and the operands of a view. */
+				lib.Rational.addArrays(an, ad, an, ad, an, ad);
+				assert.deepStrictEqual([...an], [1, -2, 4, 0, 14].map(of), `${name}: ${kind.name}`);
+				assert.deepStrictEqual([...ad], [1, 3, 3, 1, 5].map(of), `${name}: ${kind.name}`);
+
+				const view = (a) => new kind(a.buffer, kind.BYTES_PER_ELEMENT, 2);
+				lib.Rational.mulArrays(view(an), view(ad), view(bn), view(bd), view(rn), view(rd));
+				assert.deepStrictEqual([...view(rn)], [-1, -16].map(of), `${name}: ${kind.name}`);
+				assert.deepStrictEqual([...view(rd)], [9, 27].map(of), `${name}: ${kind.name}`);
+			}
+
+			/* Operands not in lowest terms give the same reduced results for every element type. */
+			for(const [kind, of] of [[Int32Array, Number], [BigInt64Array, BigInt], [Float64Array, Number]]){
+				const an = kind.from([2, 4, 0, -6, 2 ** 20].map(of)), ad = kind.from([4, 8, 6, 4, 2 ** 20].map(of));
+				const bn = kind.from([3, 6, 5, 9, 2 ** 20].map(of)), bd = kind.from([9, 4, 10, 6, 2 ** 20].map(of));
+
+				const rn = new kind(5), rd = new kind(5);
+
+				const expect = (num, den) => {
+					assert.deepStrictEqual([...rn], num.map(of), `${name}: ${kind.name}`);
+					assert.deepStrictEqual([...rd], den.map(of), `${name}: ${kind.name}`);
+				};
+
+				lib.Rational.mulArrays(an, ad, bn, bd, rn, rd);
+				expect([1, 3, 0, -9, 1], [6, 4, 1, 4, 1]);
+
+				lib.Rational.addArrays(an, ad, bn, bd, rn, rd);
+				expect([5, 2, 1, 0, 2], [6, 1, 2, 1, 1]);
+
+				lib.Rational.subArrays(an, ad, bn, bd, rn, rd);
+				expect([1, -1, -1, -3, 0], [6, 1, 2, 1, 1]);
+
+				lib.Rational.divArrays(an, ad, bn, bd, rn, rd);
+				expect([3, 1, 0, -1, 1], [2, 3, 1, 1, 1]);
+			}
+
+			const e = new Float64Array(0);
+			lib.Rational.addArrays(e, e, e, e, e, e);
+
+			const one = Float64Array.of(1), out = [new Float64Array(1), new Float64Array(1)];
+			lib.Rational.addArrays(Float64Array.of(2 ** 52), one, Float64Array.of(2 ** 52 - 1), one, ...out);
+			assert.deepStrictEqual(out.map((a) => a[0]), [Number.MAX_SAFE_INTEGER, 1], name);
+		}
+	};
+	testData.desc = 'Rational typed array batch methods ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational typed array batch methods ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			const i = (...v) => Int32Array.from(v), f = (...v) => Float64Array.from(v), b = (...v) => BigInt64Array.from(v);
+
+			for(const [fn, type, msg] of [
+				[() => R.addArrays(i(2 ** 30), i(1), i(2 ** 30), i(1), i(0), i(0)),          RangeError, 'arithmetic overflow'],
+				[() => R.mulArrays(i(1), i(2 ** 16), i(1), i(2 ** 16), i(0), i(0)),          RangeError, 'arithmetic overflow'],
+				[() => R.mulArrays(b(2n ** 62n), b(1n), b(2n), b(1n), b(0n), b(0n)),         RangeError, 'arithmetic overflow'],
+				[() => R.addArrays(f(2 ** 53), f(1), f(1), f(1), f(0), f(0)),                RangeError, 'arithmetic overflow'],
+				[() => R.addArrays(i(1), i(0), i(1), i(1), i(0), i(0)),                      TypeError,  'bad rational, zero denominator'],
+				[() => R.compareArrays(f(1), f(1), f(1), f(0), i(0)),                        TypeError,  'bad rational, zero denominator'],
+				[() => R.divArrays(b(1n), b(1n), b(0n), b(1n), b(0n), b(0n)),                TypeError,  'division by zero'],
+				[() => R.addArrays(i(1), i(-1), i(1), i(1), i(0), i(0)),                     TypeError,  'invalid argument'],
+				[() => R.addArrays(f(0.5), f(1), f(1), f(1), f(0), f(0)),                    TypeError,  'invalid argument'],
+				[() => R.addArrays(f(NaN), f(1), f(1), f(1), f(0), f(0)),                    TypeError,  'invalid argument'],
+				[() => R.addArrays(f(2 ** 63), f(1), f(1), f(1), f(0), f(0)),                TypeError,  'invalid argument'],
+				[() => R.addArrays(i(1), i(1), f(1), f(1), i(0), i(0)),                      TypeError,  'invalid argument'],
+				[() => R.addArrays(i(1), i(1), i(1), i(1), i(0), i(0, 0)),                   TypeError,  'invalid argument'],
+				[() => R.addArrays([1], [1], [1], [1], [0], [0]),                            TypeError,  'invalid argument'],
+				[() => R.addArrays(new Uint32Array(1), i(1), i(1), i(1), i(0), i(0)),        TypeError,  'invalid argument'],
+				[() => R.compareArrays(f(1), f(1), f(1), f(1), f(0)),                        TypeError,  'invalid argument'],
+				[() => R.addArrays(i(1), i(1), i(1), i(1), i(0)),                            TypeError,  'invalid number of arguments'],
+				[() => R.compareArrays(i(1), i(1), i(1), i(1), i(0), i(0)),                  TypeError,  'invalid number of arguments']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof type, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+
+			/* Nothing is stored when an operand is rejected. */
+			const out = i(7);
+			assert.throws(() => R.divArrays(i(1), i(1), i(0), i(1), out, out));
+			assert.deepStrictEqual([...out], [7], name);
+		}
+	};
+	testData.desc = 'Rational typed array batch methods ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #37 - Rational sumAsync(), sortAsync() and parseAsync() functions
+	suiteDesc = 'Rational sumAsync(), sortAsync() and parseAsync() functions';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rational sumAsync(), sortAsync() and parseAsync() functions ... valid test#1
+	testData = {};
+	testData.method = async () => {
+		for(const lib of [rational_addon, rational_module]){
+			const num = new Int32Array(10000), den = new Int32Array(10000);
+			for(let i = 0; i < num.length; i++){
+				num[i] = i % 7 - 3;
+				den[i] = i % 12 + 1;
+			}
+
+			let s = new lib.Rational();
+			for(let i = 0; i < num.length; i++)
+				s.selfAdd(new lib.Rational(num[i], den[i]));
+
+			const p = lib.Rational.sumAsync(num, den);
+			num.fill(0);
+
+			assert(p instanceof Promise);
+			assert.strictEqual((await p).toString(), s.toString());
+
+			assert.strictEqual((await lib.Rational.sumAsync(BigInt64Array.of(1n, -1n), BigInt64Array.of(2n, -6n))).toString(), '2/3');
+			assert.strictEqual((await lib.Rational.sumAsync(Float64Array.of(3, 2 ** 40), Float64Array.of(4, 2 ** 42))).toString(), '1/1');
+			assert.strictEqual((await lib.Rational.sumAsync(new Int32Array(0), new Int32Array(0))).toString(), '0/1');
+		}
+	};
+	testData.desc = 'Rational sumAsync(), sortAsync() and parseAsync() functions ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational sumAsync(), sortAsync() and parseAsync() functions ... valid test#2
+	testData = {};
+	testData.method = async () => {
+		for(const lib of [rational_addon, rational_module]){
+			const values = [3, new lib.Rational(1, 2), -2n, new lib.Rational(-1, 3), '5', new lib.Rational(1, 2)];
+
+			const sorted = await lib.Rational.sortAsync(values);
+			assert(sorted.every((r) => r instanceof lib.Rational));
+			assert.deepStrictEqual(sorted.map(String), ['-2/1', '-1/3', '1/2', '1/2', '3/1', '5/1']);
+			assert.strictEqual(values[0], 3);
+			assert.deepStrictEqual(await lib.Rational.sortAsync([]), []);
+
+			const parsed = await lib.Rational.parseAsync(['1/2', '-6/4', '7', '0/-5', `${2 ** 53}/3`]);
+			assert(parsed.every((r) => r instanceof lib.Rational));
+			assert.deepStrictEqual(parsed.map(String), ['1/2', '-3/2', '7/1', '0/1', `${2 ** 53}/3`]);
+			assert.deepStrictEqual(await lib.Rational.parseAsync([]), []);
+
+			const strings = [];
+			for(let i = 1; i <= 5000; i++)
+				strings.push(new lib.Rational(i, 7).toString());
+
+			assert.deepStrictEqual((await lib.Rational.parseAsync(strings)).map(String), strings);
+		}
+	};
+	testData.desc = 'Rational sumAsync(), sortAsync() and parseAsync() functions ... valid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational sumAsync(), sortAsync() and parseAsync() functions ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			for(const [fn, type, msg] of [
+				[() => R.sumAsync(Int32Array.of(1), Int32Array.of(0)),           TypeError, 'bad rational, zero denominator'],
+				[() => R.sumAsync(Int32Array.of(1), Float64Array.of(1)),         TypeError, 'invalid argument'],
+				[() => R.sumAsync(Int32Array.of(1), Int32Array.of(1, 1)),        TypeError, 'invalid argument'],
+				[() => R.sumAsync(Float64Array.of(0.5), Float64Array.of(1)),     TypeError, 'invalid argument'],
+				[() => R.sumAsync([1], [1]),                                     TypeError, 'invalid argument'],
+				[() => R.sortAsync({}),                                          TypeError, 'invalid argument'],
+				[() => R.sortAsync([1, {}]),                                     TypeError, 'invalid argument'],
+				[() => R.parseAsync('1/2'),                                      TypeError, 'invalid argument'],
+				[() => R.parseAsync(['1/2', 3]),                                 TypeError, 'invalid argument'],
+				[() => R.sumAsync(Int32Array.of(1)),                             TypeError, 'invalid number of arguments'],
+				[() => R.sortAsync(),                                            TypeError, 'invalid number of arguments'],
+				[() => R.parseAsync(['1'], ['2']),                               TypeError, 'invalid number of arguments']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof type, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+		}
+	};
+	testData.desc = 'Rational sumAsync(), sortAsync() and parseAsync() functions ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational sumAsync(), sortAsync() and parseAsync() functions ... invalid test#2
+	testData = {};
+	testData.method = async () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			for(const [fn, type, msg] of [
+				[() => R.parseAsync(['1/2', `${2n ** 63n}`]),                    RangeError, 'arithmetic overflow'],
+				[() => R.parseAsync(['1/2', '3/0']),                             TypeError,  'bad rational, zero denominator'],
+				[() => R.parseAsync(['1/2', '1.5']),                             TypeError,  'invalid argument'],
+				[() => R.parseAsync(['1/2', ' 1/2']),                            TypeError,  'invalid argument'],
+				[() => R.parseAsync(['1/']),                                     TypeError,  'invalid argument'],
+				[() => R.parseAsync(['']),                                       TypeError,  'invalid argument']
+			]){
+				await assert.rejects(
+					fn(),
+					(err) => {
+						assert(err instanceof type, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+		}
+
+		/* The emulating module sums in floating point, with no overflow to report. */
+		await assert.rejects(
+			rational_addon.Rational.sumAsync(Float64Array.of(1, 1), Float64Array.of(2 ** 62, 2 ** 62 - 2 ** 10)),
+			(err) => {
+				assert(err instanceof RangeError);
+				assert.strictEqual(err.message, 'Rational: arithmetic overflow');
+				return true;
+			}
+		);
+
+		/* A bad rational other than by a zero denominator names its own cause. */
+		assert.throws(
+			() => {
+				rational_addon.Rational.sumAsync(BigInt64Array.of(1n), BigInt64Array.of(-(2n ** 63n)));
+			},
+			(err) => {
+				assert(err instanceof TypeError);
+				assert.strictEqual(err.message, 'Rational: bad rational, non-zero singular denominator');
+				return true;
+			}
+		);
+	};
+	testData.desc = 'Rational sumAsync(), sortAsync() and parseAsync() functions ... invalid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #38 - Rational out-parameter static functions
+	suiteDesc = 'Rational out-parameter static functions';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rational out-parameter static functions ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const R = lib.Rational;
+			const a = new R(1, 2), b = new R(-1, 3), out = new R(7);
+
+			assert.strictEqual(R.add(a, b, out), out);
+			assert.strictEqual(out.toString(), '1/6');
+			assert.strictEqual(R.sub(a, b, out).toString(), '5/6');
+			assert.strictEqual(R.mul(a, b, out).toString(), '-1/6');
+			assert.strictEqual(R.div(a, b, out).toString(), '-3/2');
+			assert.strictEqual(R.pow(b, -3, out).toString(), '-27/1');
+			assert.strictEqual(R.pow(b, 0n, out).toString(), '1/1');
+			assert.strictEqual(R.neg(b, out).toString(), '1/3');
+			assert.strictEqual(R.abs(b, out).toString(), '1/3');
+			assert.strictEqual(R.add(3, 4n, out).toString(), '7/1');
+
+			assert.strictEqual(a.toString(), '1/2');
+			assert.strictEqual(b.toString(), '-1/3');
+
+			/* The result may be written over an operand. */
+			const s = new R();
+			for(let i = 1; i <= 100; i++)
+				R.add(s, R.div(1, i * (i + 1), out), s);
+			assert.strictEqual(s.toString(), '100/101');
+
+			R.mul(s, s, s);
+			assert.strictEqual(s.toString(), '10000/10201');
+			assert.strictEqual(R.neg(s, s).toString(), '-10000/10201');
+		}
+	};
+	testData.desc = 'Rational out-parameter static functions ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational out-parameter static functions ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+			const out = new R(5, 7);
+
+			for(const [fn, type, msg] of [
+				[() => R.add(1, 2n ** 63n, out),     RangeError, 'arithmetic overflow'],
+				[() => R.div(1, 0, out),             TypeError,  'division by zero'],
+				[() => R.div(1, new R(), out),       TypeError,  'division by zero'],
+				[() => R.pow(0, -1, out),            TypeError,  'division by zero'],
+				[() => R.pow(2, new R(1, 2), out),   TypeError,  'invalid argument'],
+				[() => R.add(1, 2, {}),              TypeError,  'invalid argument'],
+				[() => R.add(1, 2, 3),               TypeError,  'invalid argument'],
+				[() => R.mul({}, 2, out),            TypeError,  'invalid argument'],
+				[() => R.neg(1, new lib.Accumulator()), TypeError, 'invalid argument'],
+				[() => R.add(1, 2),                  TypeError,  'invalid number of arguments'],
+				[() => R.neg(1, out, out),           TypeError,  'invalid number of arguments'],
+				[() => R.abs(),                      TypeError,  'invalid number of arguments']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof type, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+
+			/* Nothing is written when an operation throws. */
+			assert.strictEqual(out.toString(), '5/7', name);
+		}
+	};
+	testData.desc = 'Rational out-parameter static functions ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #39 - Rational constants and small-rational cache
+	suiteDesc = 'Rational constants and small-rational cache';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rational constants and small-rational cache ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			for(const [key, str] of [['ZERO', '0/1'], ['ONE', '1/1'], ['TWO', '2/1'], ['MINUS_ONE', '-1/1'], ['HALF', '1/2']]){
+				assert(R[key] instanceof R, `${name}: ${key}`);
+				assert.strictEqual(R[key].toString(), str, `${name}: ${key}`);
+				assert(Object.isFrozen(R[key]), `${name}: ${key}`);
+				assert.strictEqual(Object.getOwnPropertyDescriptor(R, key).writable, false, `${name}: ${key}`);
+			}
+
+			assert.strictEqual(R.HALF.add(R.HALF).toString(), '1/1');
+			assert.strictEqual(R.TWO.pow(3).toString(), '8/1');
+			assert(R.MINUS_ONE.lessThan(R.ZERO));
+			assert.strictEqual(R.HALF.valueOf(), 0.5);
+			assert.strictEqual(new R(R.ONE).selfAdd(1).toString(), '2/1');
+
+			/* The cache is disabled by default, results being new mutable objects. */
+			const a = new R(1, 4);
+			assert.notStrictEqual(a.add(a), a.add(a));
+			assert.strictEqual(a.add(a).selfAdd(1).toString(), '3/2');
+		}
+	};
+	testData.desc = 'Rational constants and small-rational cache ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational constants and small-rational cache ... valid test#2
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const R = lib.Rational;
+			const a = new R(1, 4);
+
+			try{
+				assert.strictEqual(R.setCache(8), undefined);
+
+				assert.strictEqual(a.add(a), R.HALF);
+				assert.strictEqual(a.mul(4), R.ONE);
+				assert.strictEqual(a.sub(a), R.ZERO);
+				assert.strictEqual(a.neg().mul(4), R.MINUS_ONE);
+				assert.strictEqual(new R(4).div(2), R.TWO);
+
+				assert.strictEqual(a.abs(), a.abs());
+				assert.strictEqual(a.neg(), a.neg());
+				assert.strictEqual(new R(1, 2).pow(3), new R(1, 8).mul(1));
+				assert(Object.isFrozen(a.neg()));
+				assert.strictEqual(a.neg().toString(), '-1/4');
+
+				/* Out of bound results, and the results of constructors, are new objects. */
+				assert.notStrictEqual(new R(8).add(1), new R(8).add(1));
+				assert.notStrictEqual(new R(1, 9).neg(), new R(1, 9).neg());
+				assert.notStrictEqual(new R(1, 2), R.HALF);
+				assert(!Object.isFrozen(new R(1, 2)));
+
+				R.setCache(64);
+				assert.strictEqual(new R(-64, 63).abs(), new R(64, 63).mul(1));
+			}
+			finally{
+				R.setCache(0);
+			}
+
+			assert.notStrictEqual(a.add(a), R.HALF);
+		}
+	};
+	testData.desc = 'Rational constants and small-rational cache ... valid test#2';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rational constants and small-rational cache ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			R.setCache(4);
+			const cached = new R(1, 3).neg();
+			R.setCache(0);
+
+			for(const [fn, msg] of [
+				[() => R.ONE.selfAdd(1),         'immutable rational'],
+				[() => R.ZERO.assign(5),         'immutable rational'],
+				[() => R.HALF.selfNeg(),         'immutable rational'],
+				[() => R.TWO.preInc(),           'immutable rational'],
+				[() => R.MINUS_ONE.postDec(),    'immutable rational'],
+				[() => R.ONE.selfPow(2),         'immutable rational'],
+				[() => cached.selfAbs(),         'immutable rational'],
+				[() => cached.selfDiv(2),        'immutable rational'],
+				[() => R.add(1, 2, R.ONE),       'immutable rational'],
+				[() => R.neg(1, cached),         'immutable rational'],
+				[() => R.setCache(65),           'invalid argument'],
+				[() => R.setCache(-1),           'invalid argument'],
+				[() => R.setCache({}),           'invalid argument'],
+				[() => R.setCache(),             'invalid number of arguments']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof TypeError, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+
+			assert.strictEqual(R.ONE.toString(), '1/1', name);
+			assert.strictEqual(cached.toString(), '-1/3', name);
+
+			R.ONE = R.TWO;
+			assert.strictEqual(R.ONE.toString(), '1/1', name);
+		}
+	};
+	testData.desc = 'Rational constants and small-rational cache ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #40 - Exact conversion of fractional numbers
+	suiteDesc = 'Exact conversion of fractional numbers';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Exact conversion of fractional numbers ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			assert.strictEqual(new R(0.75).toString(), '3/4', name);
+			assert.strictEqual(new R(-2.5).toString(), '-5/2', name);
+			assert.strictEqual(new R(0.1).valueOf(), 0.1, name);
+			assert.strictEqual(new R(0.1).getDenominator(), 2 ** 55, name);
+			assert.strictEqual(new R(1.5, 0.25).toString(), '6/1', name);
+			assert.strictEqual(new R(3, -0.5).toString(), '-6/1', name);
+			assert.strictEqual(new R(2 ** -62).getDenominator(), 2 ** 62, name);
+
+			const r = new R(1);
+			r.assign(0.125);
+			assert.strictEqual(r.toString(), '1/8', name);
+			r.assign(1, 0.5);
+			assert.strictEqual(r.toString(), '2/1', name);
+
+			assert.strictEqual(new R(1, 2).add(0.25).toString(), '3/4', name);
+			assert.strictEqual(new R(1, 2).sub(0.75).toString(), '-1/4', name);
+			assert.strictEqual(new R(1, 2).mul(0.5).toString(), '1/4', name);
+			assert.strictEqual(new R(1, 2).div(0.25).toString(), '2/1', name);
+			assert.strictEqual(new R(1).selfAdd(0.5).selfSub(0.25).selfMul(1.5).selfDiv(-0.375).toString(), '-5/1', name);
+
+			assert(new R(1, 3).lessThan(0.5), name);
+			assert(new R(2, 3).greaterThan(0.5), name);
+			assert(new R(1, 2).equalTo(0.5), name);
+			assert(new R(1, 3).notEqualTo(0.3), name);
+
+			/* Exact, not the nearest fraction of small terms. */
+			assert(!new R(1, 10).equalTo(0.1), name);
+
+			assert.strictEqual(new lib.Accumulator(0.5).add(0.25).value().toString(), '3/4', name);
+			assert.strictEqual(R.add(0.5, 0.25, new R()).toString(), '3/4', name);
+		}
+
+		/* Terms beyond 2^53 printed exactly by the addon only. */
+		assert.strictEqual(new rational_addon.Rational(0.1).toString(), '3602879701896397/36028797018963968');
+	};
+	testData.desc = 'Exact conversion of fractional numbers ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Exact conversion of fractional numbers ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			for(const [fn, type, msg] of [
+				[() => new R(Infinity),            RangeError, 'arithmetic overflow'],
+				[() => new R(-Infinity, 1),        RangeError, 'arithmetic overflow'],
+				[() => new R(2 ** 63),             RangeError, 'arithmetic overflow'],
+				[() => new R(1e-300),              RangeError, 'arithmetic overflow'],
+				[() => new R(1).add(2 ** -63),     RangeError, 'arithmetic overflow'],
+				[() => new R(1).lessThan(1e300),   RangeError, 'arithmetic overflow'],
+				[() => new R(NaN),                 TypeError,  'invalid argument'],
+				[() => new R(1).selfAdd(NaN),      TypeError,  'invalid argument'],
+				[() => new R(1, 0.0),              TypeError,  'bad rational, zero denominator'],
+				[() => new R(0.5, 0),              TypeError,  'bad rational, zero denominator'],
+				[() => new R(1).div(0.0),          TypeError,  'division by zero']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof type, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+		}
+	};
+	testData.desc = 'Exact conversion of fractional numbers ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #41 - Best rational approximation
+	suiteDesc = 'Best rational approximation';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Best rational approximation ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			assert.strictEqual(R.fromNumber(Math.PI, 1000).toString(), '355/113', name);
+			assert.strictEqual(R.fromNumber(Math.PI, 100).toString(), '311/99', name);
+			assert.strictEqual(R.fromNumber(-Math.PI, 1000).toString(), '-355/113', name);
+			assert.strictEqual(R.fromNumber(0.1, 1000000).toString(), '1/10', name);
+			assert.strictEqual(R.fromNumber(0.75).toString(), '3/4', name);
+			assert.strictEqual(R.fromNumber(5, 3).toString(), '5/1', name);
+			assert.strictEqual(R.fromNumber(5n, 3).toString(), '5/1', name);
+			assert.strictEqual(R.fromNumber(0.5, 1).toString(), '0/1', name);
+
+			/* Below 2^-10, the exact denominator being beyond 64 bits. */
+			assert.strictEqual(R.fromNumber(1e-300, 1000).toString(), '0/1', name);
+			assert.strictEqual(R.fromNumber(1 / 3000, 10000).toString(), '1/3000', name);
+			assert.strictEqual(R.fromNumber(-1e-5, 200000).toString(), '-1/100000', name);
+
+			const r = new R(314159265, 100000000);
+			assert.strictEqual(r.limitDenominator(1000).toString(), '355/113', name);
+			assert.strictEqual(r.limitDenominator(7).toString(), '22/7', name);
+			assert.strictEqual(r.limitDenominator(1).toString(), '3/1', name);
+			assert.strictEqual(r.limitDenominator(100000000).toString(), '62831853/20000000', name);
+			assert.strictEqual(new R(3, 8).limitDenominator(2).toString(), '1/2', name);
+			assert.strictEqual(new R(-1, 2).limitDenominator(1).toString(), '-1/1', name);
+			assert.strictEqual(r.toString(), '62831853/20000000', name);
+		}
+	};
+	testData.desc = 'Best rational approximation ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Best rational approximation ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			for(const [fn, type, msg] of [
+				[() => R.fromNumber(),                  TypeError,  'invalid number of arguments'],
+				[() => R.fromNumber(1, 2, 3),           TypeError,  'invalid number of arguments'],
+				[() => R.fromNumber('1/2', 10),         TypeError,  'invalid argument'],
+				[() => R.fromNumber(NaN, 10),           TypeError,  'invalid argument'],
+				[() => R.fromNumber(0.5, 0),            TypeError,  'invalid argument'],
+				[() => R.fromNumber(0.5, {}),           TypeError,  'invalid argument'],
+				[() => R.fromNumber(Infinity, 10),      RangeError, 'arithmetic overflow'],
+				[() => R.fromNumber(2 ** 64, 10),       RangeError, 'arithmetic overflow'],
+				[() => new R(1, 3).limitDenominator(),  TypeError,  'invalid number of arguments'],
+				[() => new R(1, 3).limitDenominator(-1), TypeError, 'invalid argument']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof type, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+		}
+	};
+	testData.desc = 'Best rational approximation ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #42 - Correctly rounded conversion
+	suiteDesc = 'Correctly rounded conversion';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Correctly rounded conversion ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			assert.strictEqual(new R(1, 3).valueOf(), 1 / 3, name);
+			assert.strictEqual(new R(-22, 7).valueOf(), -22 / 7, name);
+			assert.strictEqual(new R(0.1).valueOf(), 0.1, name);
+			assert.strictEqual(+new R(3, 4), 0.75, name);
+		}
+
+		/* Terms beyond 53 bits, held by the addon only. */
+		const R = rational_addon.Rational;
+
+		assert.strictEqual(new R(6957976319337655507n, 4377879084656308313n).valueOf(), 1.5893486742756628);
+		assert.strictEqual(new R(7678669178672730304n, 4153793910940307729n).valueOf(), 1.8485917557076117);
+		assert.strictEqual(new R(9007199254740993n).valueOf(), 9007199254740992);
+		assert.strictEqual(new R(9007199254740995n).valueOf(), 9007199254740996);
+		assert.strictEqual(new R(-(2n ** 63n), 3n).valueOf(), -3074457345618258432);
+	};
+	testData.desc = 'Correctly rounded conversion ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #43 - Rounding and decimal conversion
+	suiteDesc = 'Rounding and decimal conversion';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Rounding and decimal conversion ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			const x = [[-5, 2], [-3, 2], [-3, 5], [-1, 2], [-2, 5], [2, 5], [1, 2], [3, 5], [3, 2], [5, 2]].map(([n, d]) => new R(n, d));
+			const y = {
+				floor:      [-3, -2, -1, -1, -1,  0,  0,  0,  1,  2],
+				ceil:       [-2, -1,  0,  0,  0,  1,  1,  1,  2,  3],
+				trunc:      [-2, -1,  0,  0,  0,  0,  0,  0,  1,  2],
+				expand:     [-3, -2, -1, -1, -1,  1,  1,  1,  2,  3],
+				halfFloor:  [-3, -2, -1, -1,  0,  0,  0,  1,  1,  2],
+				halfCeil:   [-2, -1, -1,  0,  0,  0,  1,  1,  2,  3],
+				halfTrunc:  [-2, -1, -1,  0,  0,  0,  0,  1,  1,  2],
+				halfExpand: [-3, -2, -1, -1,  0,  0,  1,  1,  2,  3],
+				halfEven:   [-2, -2, -1,  0,  0,  0,  0,  1,  2,  2]
+			};
+
+			for(const mode in y){
+				assert.deepStrictEqual(x.map((r) => r.round(mode).toString()), y[mode].map((n) => `${n}/1`), `${name}: ${mode}`);
+			}
+
+			assert.deepStrictEqual(x.map((r) => r.round().valueOf()), y.halfEven, name);
+			assert.deepStrictEqual(x.map((r) => r.floor().valueOf()), y.floor, name);
+			assert.deepStrictEqual(x.map((r) => r.ceil().valueOf()), y.ceil, name);
+			assert(x[0].floor() instanceof R, name);
+
+			assert.strictEqual(new R(1, 3).toFixed(2), '0.33', name);
+			assert.strictEqual(new R(-2, 3).toFixed(2), '-0.67', name);
+			assert.strictEqual(new R(1, 8).toFixed(2), '0.12', name);
+			assert.strictEqual(new R(1, 8).toFixed(2, 'halfExpand'), '0.13', name);
+			assert.strictEqual(new R(-1999, 200).toFixed(2), '-10.00', name);
+			assert.strictEqual(new R(-1, 1000).toFixed(2), '0.00', name);
+			assert.strictEqual(new R(-1, 1000).toFixed(2, 'floor'), '-0.01', name);
+			assert.strictEqual(new R(7, 2).toFixed(), '4', name);
+			assert.strictEqual(new R(7, 2).toFixed(undefined, 'trunc'), '3', name);
+			assert.strictEqual(new R(1, 7).toFixed(30), '0.142857142857142857142857142857', name);
+			assert.strictEqual(new R(2, 3).toFixed(100), `0.${'6'.repeat(99)}7`, name);
+		}
+
+		/* Terms beyond 53 bits, held by the addon only. */
+		const R = rational_addon.Rational;
+
+		assert.strictEqual(new R(-(2n ** 63n)).toFixed(3), '-9223372036854775808.000');
+		assert.strictEqual(new R(2n ** 63n - 2n, 2n ** 63n - 1n).toFixed(20), '0.99999999999999999989');
+		assert.strictEqual(new R(2n ** 63n - 1n, 2n).round().valueOf(), 4611686018427387904);
+	};
+	testData.desc = 'Rounding and decimal conversion ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Rounding and decimal conversion ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const r = new lib.Rational(1, 3);
+
+			for(const [fn, msg] of [
+				[() => r.floor(1),              'invalid number of arguments'],
+				[() => r.ceil(1),               'invalid number of arguments'],
+				[() => r.round('halfEven', 1),  'invalid number of arguments'],
+				[() => r.toFixed(1, 'floor', 1), 'invalid number of arguments'],
+				[() => r.round('half'),         'invalid argument'],
+				[() => r.round(1),              'invalid argument'],
+				[() => r.toFixed(-1),           'invalid argument'],
+				[() => r.toFixed(101),          'invalid argument'],
+				[() => r.toFixed('x'),          'invalid argument'],
+				[() => r.toFixed(2.7),          'invalid argument'],
+				[() => r.toFixed(0.5),          'invalid argument'],
+				[() => r.toFixed(2, 'HALFEVEN'), 'invalid argument']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof TypeError, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+
+			assert.strictEqual(r.toFixed(2.0), '0.33', name);
+		}
+	};
+	testData.desc = 'Rounding and decimal conversion ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #44 - Repeating decimal expansion
+	suiteDesc = 'Repeating decimal expansion';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Repeating decimal expansion ... valid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const R = lib.Rational;
+
+			assert.strictEqual(new R(1, 7).toDecimalString(), '0.(142857)', name);
+			assert.strictEqual(new R(1, 7).toDecimalString({ maxDigits: 20, repeat: true }), '0.(142857)', name);
+			assert.strictEqual(new R(-7, 6).toDecimalString(), '-1.1(6)', name);
+			assert.strictEqual(new R(1, 12).toDecimalString(), '0.08(3)', name);
+			assert.strictEqual(new R(3, 8).toDecimalString(), '0.375', name);
+			assert.strictEqual(new R(-5).toDecimalString(), '-5', name);
+			assert.strictEqual(new R(0).toDecimalString(), '0', name);
+			assert.strictEqual(new R(1, 7).toDecimalString({ maxDigits: 6 }), '0.(142857)', name);
+			assert.strictEqual(new R(1, 7).toDecimalString({ maxDigits: 5 }), '0.14285...', name);
+			assert.strictEqual(new R(1, 7).toDecimalString({ maxDigits: 0 }), '0...', name);
+			assert.strictEqual(new R(1, 7).toDecimalString({ maxDigits: 8, repeat: false }), '0.14285714...', name);
+			assert.strictEqual(new R(3, 8).toDecimalString({ repeat: false }), '0.375', name);
+			assert.strictEqual(new R(1, 3).toDecimalString({ maxDigits: undefined, repeat: undefined }), '0.(3)', name);
+			assert.strictEqual(new R(1, 3).toDecimalString(undefined), '0.(3)', name);
+			assert.strictEqual(new R(1, 3).toDecimalString({ repeat: false }), `0.${'3'.repeat(100)}...`, name);
+			assert.strictEqual(new R(1, 983).toDecimalString({ maxDigits: 1000 }).length, 2 + 982 + 2, name);
+
+			/* Against the remainders found by a search of all the previous ones. */
+			for(let n = -60; n <= 60; n += 7){
+				for(let d = 1; d <= 120; d++){
+					const r = new R(n, d);
+					const a = Math.abs(r.getNumerator()), b = r.getDenominator();
+
+					let expected = `${r.getNumerator() < 0 ? '-' : ''}${Math.trunc(a / b)}`;
+					let rem = a % b, digits = '';
+					const seen = [];
+
+					if(rem) expected += '.';
+
+					while(rem){
+						if(seen.includes(rem)){
+							const i = seen.indexOf(rem);
+							expected += `${digits.slice(0, i)}(${digits.slice(i)})`;
+							break;
+						}
+
+						seen.push(rem);
+						digits += Math.trunc(rem * 10 / b);
+						rem = rem * 10 % b;
+
+						if(!rem) expected += digits;
+					}
+
+					assert.strictEqual(r.toDecimalString({ maxDigits: 120 }), expected, `${name}: ${n}/${d}`);
+				}
+			}
+		}
+
+		/* Terms beyond 53 bits, held by the addon only. */
+		const R = rational_addon.Rational;
+
+		assert.strictEqual(new R(-(2n ** 63n), 2n ** 63n - 1n).toDecimalString({ maxDigits: 25 }), '-1.0000000000000000001084202...');
+	};
+	testData.desc = 'Repeating decimal expansion ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST ### - Repeating decimal expansion ... invalid test#1
+	testData = {};
+	testData.method = () => {
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const r = new lib.Rational(1, 3);
+
+			for(const [fn, msg] of [
+				[() => r.toDecimalString({}, 1),                'invalid number of arguments'],
+				[() => r.toDecimalString(20),                   'invalid argument'],
+				[() => r.toDecimalString(null),                 'invalid argument'],
+				[() => r.toDecimalString({ maxDigits: -1 }),    'invalid argument'],
+				[() => r.toDecimalString({ maxDigits: 1001 }),  'invalid argument'],
+				[() => r.toDecimalString({ maxDigits: 'x' }),   'invalid argument'],
+				[() => r.toDecimalString({ maxDigits: 5.5 }),   'invalid argument'],
+				[() => r.toDecimalString({ repeat: 1 }),        'invalid argument']
+			]){
+				assert.throws(
+					fn,
+					(err) => {
+						assert(err instanceof TypeError, `${name}: ${fn}`);
+						assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${fn}`);
+						return true;
+					}
+				);
+			}
+		}
+	};
+	testData.desc = 'Repeating decimal expansion ... invalid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
+
+	// TEST SUITE #45 - Optimized method calls
+	suiteDesc = 'Optimized method calls';
+	suites.set(suiteDesc, []);
+
+	// TEST ### - Optimized method calls ... valid test#1
+	testData = {};
+	testData.method = () => {
+		v8.setFlagsFromString('--allow-natives-syntax');
+
+		const prepare  = new Function('f', '%PrepareFunctionForOptimization(f);');
+		const optimize = new Function('f', '%OptimizeFunctionOnNextCall(f);');
+		const status   = new Function('f', 'return %GetOptimizationStatus(f);');
+
+		/* The optimized bit of the status, set while the function runs TurboFan code. */
+		const isOptimized = (f) => (status(f) & 1 << 4) !== 0;
+
+		/* A call of the given method, optimized by TurboFan on its next call, taking the fast API overload if any. */
+		const optimized = (method, x, ...args) => {
+			const f = new Function('x', 'v', `return x.${method}(${args.length ? 'v' : ''});`);
+
+			prepare(f);
+			f(x, ...args);
+			f(x, ...args);
+			optimize(f);
+
+			return f;
+		};
+
+		for(const lib of [rational_addon, rational_module]){
+			const name = lib === rational_addon ? 'rational_addon' : 'rational_module';
+			const r = new lib.Rational(-7, 2);
+
+			const lessThan    = optimized('lessThan', r, 0);
+			const greaterThan = optimized('greaterThan', r, 0);
+			const equalTo     = optimized('equalTo', r, 0);
+
+			for(const [v, lt, gt, eq] of [
+				[-3,          true,  false, false],
+				[-4,          false, true,  false],
+				[-3.5,        false, false, true],
+				[-3.25,       true,  false, false],
+				[2 ** 62,     true,  false, false],
+				[-(2 ** 62),  false, true,  false]
+			]){
+				assert.strictEqual(lessThan(r, v),    lt, `${name}: lessThan(${v})`);
+				assert.strictEqual(greaterThan(r, v), gt, `${name}: greaterThan(${v})`);
+				assert.strictEqual(equalTo(r, v),     eq, `${name}: equalTo(${v})`);
+			}
+
+			/* Arguments the fast calls leave to the callbacks throw as usual. */
+			for(const f of [lessThan, greaterThan, equalTo]){
+				for(const [v, type, msg] of [[NaN, TypeError, 'invalid argument'], [Infinity, RangeError, 'arithmetic overflow'], [1e300, RangeError, 'arithmetic overflow']]){
+					assert.throws(
+						() => {
+							f(r, v);
+						},
+						(err) => {
+							assert(err instanceof type, `${name}: ${f}(${v})`);
+							assert.strictEqual(err.message, `Rational: ${msg}`, `${name}: ${f}(${v})`);
+							return true;
+						}
+					);
+				}
+			}
+
+			assert.strictEqual(equalTo(r, -3.5), true, name);
+
+			for(const f of [lessThan, greaterThan, equalTo])
+				assert(isOptimized(f), `${name}: ${f} optimized`);
+
+			const valueOf        = optimized('valueOf', r);
+			const getNumerator   = optimized('getNumerator', r);
+			const getDenominator = optimized('getDenominator', r);
+
+			for(const [x, value, num, den] of [[r, -3.5, -7, 2], [new lib.Rational(1, 3), 1 / 3, 1, 3], [new lib.Rational(2 ** 60 + 1, 3), (2 ** 60 + 1) / 3, 2 ** 60 + 1, 3]]){
+				assert.strictEqual(valueOf(x),        value, `${name}: valueOf()`);
+				assert.strictEqual(getNumerator(x),   num,   `${name}: getNumerator()`);
+				assert.strictEqual(getDenominator(x), den,   `${name}: getDenominator()`);
+			}
+
+			for(const f of [valueOf, getNumerator, getDenominator])
+				assert(isOptimized(f), `${name}: ${f} optimized`);
+		}
+	};
+	testData.desc = 'Optimized method calls ... valid test#1';
+
+	testData.skip = false;
+	suites.get(suiteDesc).push(testData);
 }
 
 /**
@@ -6652,11 +8668,11 @@ async function makeTest(obj){
 	cmdOptions.verbose && console.error(preMsg);
 
 	if(!cmdOptions.verbose){
-		obj.method();
+		await obj.method();
 	}   /* node:coverage disable */
 	else{
 		try{
-			obj.method();
+			await obj.method();
 			passCount++;
 
 			postMsg += `Success  ... ${obj.desc}`;